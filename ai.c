@@ -1,6 +1,9 @@
 #include "ai.h"
-#include <furi.h>
-#include <stdlib.h>
+#include "mcts.h"
+#include "preflop.h"
+#include "profile.h"
+#include "strategy.h"
+#include "trace.h"
 
 void ai_init_players(AIPlayer* ai_players) {
     // AI Player 1 - Conservative
@@ -38,6 +41,8 @@ void ai_init_players(AIPlayer* ai_players) {
         for(uint8_t j = 0; j < MAX_PLAYERS; j++) {
             ai_players[i].opponent_aggression[j] = 0.5f; // Start with neutral assumption
         }
+        ai_players[i].strength_cache.valid = false;
+        ai_players[i].search_threads = 1;
     }
 }
 
@@ -81,8 +86,7 @@ float ai_evaluate_hand_strength(Card* hand, Card* community, uint8_t community_c
     // Add some variance based on hand value within the rank
     if(result.rank <= HAND_PAIR) {
         // For high card and pair, consider the actual card values
-        uint8_t high_card = (result.value >> 16) & 0xF;
-        if(high_card == 0) high_card = (result.value >> 12) & 0xF;
+        uint8_t high_card = poker_hand_primary_rank(result.strength);
         
         if(high_card >= RANK_JACK) {
             base_strength += 0.05f;
@@ -95,7 +99,54 @@ float ai_evaluate_hand_strength(Card* hand, Card* community, uint8_t community_c
     return base_strength;
 }
 
+uint32_t ai_think_budget_us(AIDifficulty difficulty) {
+    switch(difficulty) {
+        case AI_EASY:
+            return AI_THINK_EASY_US;
+        case AI_MEDIUM:
+            return AI_THINK_MEDIUM_US;
+        case AI_HARD:
+            return AI_THINK_HARD_US;
+    }
+    return AI_THINK_EASY_US;
+}
+
+// Strength used by the decision code. Preflop it is the precomputed
+// starting-hand equity against the players still in the hand, rescaled so
+// that a fair share of the pot lands at 0.5; after the flop it is the
+// made-hand category lookup. AI_HARD seats search instead (ai_search), so
+// only the threshold bots and the search's opponent model get here.
+// ai_decide_action and ai_decide_raise_amount both ask for it, so the result
+// is cached per AI until the board or the number of players changes.
+static float ai_hand_strength(GameState* game, uint8_t player_index, AIPlayer* ai_player) {
+    Player* player = &game->players[player_index];
+    AIStrengthCache* cache = &ai_player->strength_cache;
+    
+    if(cache->valid && cache->hole == player->hand_set && cache->board == game->community_set &&
+       cache->opponents == game->active_players) {
+        return cache->strength;
+    }
+    
+    float strength;
+    if(game->community_count == 0) {
+        uint8_t opponents = game->active_players > 1 ? game->active_players - 1 : 1;
+        float fair_share = 1.0f / (opponents + 1);
+        strength = preflop_equity(player->hand_set, opponents) * 0.5f / fair_share;
+        if(strength > 1.0f) strength = 1.0f;
+    } else {
+        strength = ai_evaluate_hand_strength(player->hand, game->community, game->community_count);
+    }
+    
+    cache->valid = true;
+    cache->hole = player->hand_set;
+    cache->board = game->community_set;
+    cache->opponents = game->active_players;
+    cache->strength = strength;
+    return strength;
+}
+
 bool ai_should_bluff(AIPlayer* ai_player, GameState* game, uint8_t player_index) {
+    (void)player_index; // Part of the decision-helper signature, unused here
     // Simple bluffing logic based on personality and situation
     float bluff_chance = ai_player->bluff_frequency;
     
@@ -114,7 +165,7 @@ bool ai_should_bluff(AIPlayer* ai_player, GameState* game, uint8_t player_index)
         bluff_chance *= 1.3f;
     }
     
-    return (rand() % 100) < (bluff_chance * 100);
+    return rng_bounded(&game->rng, 100) < (bluff_chance * 100);
 }
 
 PlayerAction ai_decide_action(GameState* game, uint8_t player_index, AIPlayer* ai_player) {
@@ -126,7 +177,7 @@ PlayerAction ai_decide_action(GameState* game, uint8_t player_index, AIPlayer* a
     }
     
     // Evaluate hand strength
-    float hand_strength = ai_evaluate_hand_strength(player->hand, game->community, game->community_count);
+    float hand_strength = ai_hand_strength(game, player_index, ai_player);
     
     // Calculate pot odds if there's a bet to call
     float pot_odds = ai_calculate_pot_odds(game, player_index);
@@ -157,7 +208,10 @@ PlayerAction ai_decide_action(GameState* game, uint8_t player_index, AIPlayer* a
             // Less affected by opponent aggression
             break;
         case AI_RANDOM:
-            action_threshold += ((rand() % 21) - 10) * 0.01f; // +/- 0.1 random
+            action_threshold += ((int)rng_bounded(&game->rng, 21) - 10) * 0.01f; // +/- 0.1 random
+            break;
+        case AI_STRATEGY:
+            // Only reached when ai_decide is bypassed; plays as is
             break;
     }
     
@@ -232,7 +286,7 @@ PlayerAction ai_decide_action(GameState* game, uint8_t player_index, AIPlayer* a
 
 uint32_t ai_decide_raise_amount(GameState* game, uint8_t player_index, AIPlayer* ai_player) {
     Player* player = &game->players[player_index];
-    float hand_strength = ai_evaluate_hand_strength(player->hand, game->community, game->community_count);
+    float hand_strength = ai_hand_strength(game, player_index, ai_player);
     
     // Base raise amount (fraction of pot)
     float raise_factor = 0.5f;
@@ -256,7 +310,9 @@ uint32_t ai_decide_raise_amount(GameState* game, uint8_t player_index, AIPlayer*
             raise_factor *= 1.3f;
             break;
         case AI_RANDOM:
-            raise_factor *= (0.7f + (rand() % 6) * 0.1f); // 0.7x to 1.2x
+            raise_factor *= (0.7f + rng_bounded(&game->rng, 6) * 0.1f); // 0.7x to 1.2x
+            break;
+        case AI_STRATEGY:
             break;
     }
     
@@ -281,6 +337,38 @@ uint32_t ai_decide_raise_amount(GameState* game, uint8_t player_index, AIPlayer*
     return raise_amount;
 }
 
+// AI_HARD plays the hand out many times from here instead of following the
+// thresholds; the search picks the raise size as well
+static Action ai_search(GameState* game, uint8_t player_index, AIPlayer* ai_player) {
+    MctsBudget budget = {
+        .max_iterations = AI_SEARCH_ITERATIONS,
+        .max_time_us = ai_think_budget_us(ai_player->difficulty),
+        .threads = ai_player->search_threads,
+        .seed = rng_next(&game->rng),
+    };
+    return mcts_search(game, player_index, &budget).action;
+}
+
+// Full decision as an engine Action. ai_decide_raise_amount sizes the chips
+// added to the current bet, the engine wants the total to raise to.
+Action ai_decide(GameState* game, uint8_t player_index, AIPlayer* ai_player) {
+    PROFILE_SCOPE(PROFILE_AI_DECIDE);
+    TRACE_SCOPE(TRACE_AI_DECIDE);
+    Player* player = &game->players[player_index];
+    if(ai_player->difficulty == AI_HARD && !player->all_in && !player->folded) {
+        return ai_search(game, player_index, ai_player);
+    }
+    if(ai_player->personality == AI_STRATEGY && !player->all_in && !player->folded) {
+        return strategy_decide(game, player_index, &game->rng);
+    }
+    Action action = {ai_decide_action(game, player_index, ai_player), 0};
+    if(action.type == ACTION_RAISE) {
+        action.amount = game->players[player_index].bet +
+                        ai_decide_raise_amount(game, player_index, ai_player);
+    }
+    return action;
+}
+
 float ai_calculate_pot_odds(GameState* game, uint8_t player_index) {
     Player* player = &game->players[player_index];
     uint32_t call_amount = game->current_bet - player->bet;
@@ -335,6 +423,7 @@ void ai_update_opponent_model(AIPlayer* ai_player, uint8_t opponent_id, PlayerAc
 }
 
 bool ai_should_fold_to_aggression(AIPlayer* ai_player, GameState* game, uint8_t player_index) {
+    (void)player_index; // Part of the decision-helper signature, unused here
     // Check if facing a very aggressive opponent
     uint8_t aggressor = game->current_player;
     for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
@@ -9,13 +9,35 @@ typedef enum {
     AI_HARD
 } AIDifficulty;
 
+// Wall-clock thinking budget per difficulty. Sampling stops when it runs out
+// (anytime cut-off), so it bounds how long a decision can take on the device.
+#define AI_THINK_EASY_US 5000
+#define AI_THINK_MEDIUM_US 20000
+#define AI_THINK_HARD_US 150000
+
+// Search iterations of AI_HARD's decisions (mcts.h); again the time budget
+// may cut it short, which is what happens on the device
+#define AI_SEARCH_ITERATIONS 2000
+
 // AI personality types
 typedef enum {
     AI_CONSERVATIVE = 0,
     AI_AGGRESSIVE,
-    AI_RANDOM
+    AI_RANDOM,
+    AI_STRATEGY // Plays the trained strategy table (strategy.h)
 } AIPersonality;
 
+// Last hand strength an AI computed. The key changes when a new street is
+// dealt (board) or a player folds (opponents), so every action within a
+// street reuses one evaluation, however expensive the estimate is.
+typedef struct {
+    bool valid;
+    uint8_t opponents;
+    CardSet hole;
+    CardSet board;
+    float strength;
+} AIStrengthCache;
+
 // AI player structure
 typedef struct {
     AIDifficulty difficulty;
@@ -29,12 +51,16 @@ typedef struct {
     float opponent_aggression[MAX_PLAYERS]; // Track other players' aggression
     uint8_t position_awareness; // 0-3 for position consideration
     float risk_tolerance; // How willing to take risks
+    AIStrengthCache strength_cache;
+    uint8_t search_threads; // AI_HARD search trees in parallel (host), 0 = one per core
 } AIPlayer;
 
 // Function declarations
 void ai_init_players(AIPlayer* ai_players);
 PlayerAction ai_decide_action(GameState* game, uint8_t player_index, AIPlayer* ai_player);
 uint32_t ai_decide_raise_amount(GameState* game, uint8_t player_index, AIPlayer* ai_player);
+Action ai_decide(GameState* game, uint8_t player_index, AIPlayer* ai_player);
+uint32_t ai_think_budget_us(AIDifficulty difficulty);
 float ai_evaluate_hand_strength(Card* hand, Card* community, uint8_t community_count);
 bool ai_should_bluff(AIPlayer* ai_player, GameState* game, uint8_t player_index);
 
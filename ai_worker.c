@@ -0,0 +1,170 @@
+#include "ai_worker.h"
+#include "platform.h"
+#include "trace.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HOLDEM_HOST
+#include <pthread.h>
+#else
+#define AI_WORKER_STACK_SIZE 4096
+#define AI_WORKER_FLAG_WAKE (1 << 0)
+#endif
+
+struct AIWorker {
+    AIWorkerCallback callback;
+    void* context;
+
+    // Request slot, guarded by the lock
+    bool pending;
+    bool stop;
+    uint32_t next_id;
+    uint32_t request_id;
+    uint8_t seat;
+    GameState game;
+    AIPlayer ai_player;
+
+#ifdef HOLDEM_HOST
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+#else
+    FuriThread* thread;
+    FuriMutex* lock;
+#endif
+};
+
+#ifdef HOLDEM_HOST
+static void ai_worker_lock(AIWorker* worker) {
+    pthread_mutex_lock(&worker->lock);
+}
+
+static void ai_worker_unlock(AIWorker* worker) {
+    pthread_mutex_unlock(&worker->lock);
+}
+
+static void ai_worker_wake(AIWorker* worker) {
+    pthread_cond_signal(&worker->wake);
+}
+
+// Called with the lock held, returns with it held
+static void ai_worker_wait(AIWorker* worker) {
+    pthread_cond_wait(&worker->wake, &worker->lock);
+}
+#else
+static void ai_worker_lock(AIWorker* worker) {
+    furi_mutex_acquire(worker->lock, FuriWaitForever);
+}
+
+static void ai_worker_unlock(AIWorker* worker) {
+    furi_mutex_release(worker->lock);
+}
+
+static void ai_worker_wake(AIWorker* worker) {
+    furi_thread_flags_set(furi_thread_get_id(worker->thread), AI_WORKER_FLAG_WAKE);
+}
+
+static void ai_worker_wait(AIWorker* worker) {
+    ai_worker_unlock(worker);
+    furi_thread_flags_wait(AI_WORKER_FLAG_WAKE, FuriFlagWaitAny, FuriWaitForever);
+    ai_worker_lock(worker);
+}
+#endif
+
+static void ai_worker_run(AIWorker* worker) {
+    // Private copies, so the caller can post new requests while we think
+    GameState game;
+    AIDecision decision;
+
+    TRACE_THREAD_NAME("ai worker");
+    ai_worker_lock(worker);
+    while(true) {
+        TRACE_BEGIN(TRACE_AI_WORKER_WAIT);
+        while(!worker->pending && !worker->stop) {
+            ai_worker_wait(worker);
+        }
+        TRACE_END(TRACE_AI_WORKER_WAIT);
+        if(worker->stop) break;
+
+        memcpy(&game, &worker->game, sizeof(GameState));
+        decision.ai_player = worker->ai_player;
+        decision.request_id = worker->request_id;
+        decision.seat = worker->seat;
+        worker->pending = false;
+        ai_worker_unlock(worker);
+
+        uint64_t start = platform_time_us();
+        decision.action = ai_decide(&game, decision.seat, &decision.ai_player);
+        decision.think_us = (uint32_t)(platform_time_us() - start);
+        decision.rng = game.rng;
+        worker->callback(&decision, worker->context);
+
+        ai_worker_lock(worker);
+    }
+    ai_worker_unlock(worker);
+}
+
+#ifdef HOLDEM_HOST
+static void* ai_worker_thread(void* ctx) {
+    ai_worker_run((AIWorker*)ctx);
+    return NULL;
+}
+#else
+static int32_t ai_worker_thread(void* ctx) {
+    ai_worker_run((AIWorker*)ctx);
+    return 0;
+}
+#endif
+
+AIWorker* ai_worker_alloc(AIWorkerCallback callback, void* context) {
+    AIWorker* worker = malloc(sizeof(AIWorker));
+    memset(worker, 0, sizeof(AIWorker));
+    worker->callback = callback;
+    worker->context = context;
+
+#ifdef HOLDEM_HOST
+    pthread_mutex_init(&worker->lock, NULL);
+    pthread_cond_init(&worker->wake, NULL);
+    pthread_create(&worker->thread, NULL, ai_worker_thread, worker);
+#else
+    worker->lock = furi_mutex_alloc(FuriMutexTypeNormal);
+    worker->thread = furi_thread_alloc_ex("HoldemAI", AI_WORKER_STACK_SIZE, ai_worker_thread, worker);
+    furi_thread_start(worker->thread);
+#endif
+
+    return worker;
+}
+
+// Waits for a decision in progress to finish (its callback still runs)
+void ai_worker_free(AIWorker* worker) {
+    ai_worker_lock(worker);
+    worker->stop = true;
+    ai_worker_wake(worker);
+    ai_worker_unlock(worker);
+
+#ifdef HOLDEM_HOST
+    pthread_join(worker->thread, NULL);
+    pthread_cond_destroy(&worker->wake);
+    pthread_mutex_destroy(&worker->lock);
+#else
+    furi_thread_join(worker->thread);
+    furi_thread_free(worker->thread);
+    furi_mutex_free(worker->lock);
+#endif
+
+    free(worker);
+}
+
+uint32_t ai_worker_request(AIWorker* worker, const GameState* game, uint8_t seat, const AIPlayer* ai_player) {
+    ai_worker_lock(worker);
+    uint32_t request_id = ++worker->next_id;
+    memcpy(&worker->game, game, sizeof(GameState));
+    worker->ai_player = *ai_player;
+    worker->seat = seat;
+    worker->request_id = request_id;
+    worker->pending = true;
+    ai_worker_wake(worker);
+    ai_worker_unlock(worker);
+
+    return request_id;
+}
\ No newline at end of file
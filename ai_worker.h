@@ -0,0 +1,32 @@
+#pragma once
+
+#include "ai.h"
+
+// Runs AI decisions on a dedicated thread so the caller (the app's event
+// loop, a host tool) never blocks while a bot thinks. A request carries a
+// snapshot of the game and of the AI; the decision comes back through a
+// callback on the worker thread, together with the AI and game random state
+// as they were after deciding, for the caller to write back.
+//
+// Each worker has one request slot: a new request replaces one that has not
+// started yet, and callers match decisions to requests by request_id. On the
+// device the worker is a FuriThread, on the host a pthread, so several
+// workers can think in parallel there.
+
+typedef struct {
+    uint32_t request_id;
+    uint8_t seat;
+    Action action;
+    AIPlayer ai_player; // The AI after deciding (strength cache, ...)
+    Rng rng; // GameState.rng after deciding
+    uint32_t think_us; // Wall time spent deciding
+} AIDecision;
+
+typedef void (*AIWorkerCallback)(const AIDecision* decision, void* context);
+
+typedef struct AIWorker AIWorker;
+
+// Function declarations
+AIWorker* ai_worker_alloc(AIWorkerCallback callback, void* context);
+void ai_worker_free(AIWorker* worker);
+uint32_t ai_worker_request(AIWorker* worker, const GameState* game, uint8_t seat, const AIPlayer* ai_player);
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include "buckets.h"
+#include <string.h>
+
+#ifdef HOLDEM_HOST
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Canonical form of a board under suit relabelling: suits are reordered by
+// their rank masks on the board, highest first (ties keep suit order), so
+// every board of one isomorphism class maps to the same CardSet. `hole`, if
+// given, is relabelled the same way.
+CardSet buckets_canonical(CardSet board, CardSet* hole) {
+    uint32_t masks[4];
+    uint8_t order[4];
+    for(uint8_t suit = 0; suit < 4; suit++) {
+        masks[suit] = poker_suit_mask(board, (CardSuit)suit);
+        order[suit] = suit;
+    }
+    for(uint8_t i = 1; i < 4; i++) {
+        uint8_t suit = order[i];
+        uint8_t j = i;
+        while(j > 0 && masks[order[j - 1]] < masks[suit]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = suit;
+    }
+
+    CardSet canonical = 0;
+    CardSet mapped = 0;
+    for(uint8_t i = 0; i < 4; i++) {
+        canonical |= (CardSet)masks[order[i]] << (i * SUIT_LANE_BITS);
+        if(hole) mapped |= (CardSet)poker_suit_mask(*hole, (CardSuit)order[i]) << (i * SUIT_LANE_BITS);
+    }
+    if(hole) *hole = mapped;
+    return canonical;
+}
+
+// Colex index of a hole pair among the cards not on `board`:
+// 0 .. C(52 - board cards, 2) - 1
+uint32_t buckets_hole_index(CardSet hole, CardSet board) {
+    uint8_t low = (uint8_t)__builtin_ctzll(hole);
+    uint8_t high = (uint8_t)(63 - __builtin_clzll(hole));
+    uint32_t low_left = low - poker_set_count(board & ((1ULL << low) - 1));
+    uint32_t high_left = high - poker_set_count(board & ((1ULL << high) - 1));
+    return high_left * (high_left - 1) / 2 + low_left;
+}
+
+void buckets_header_init(BucketHeader* header, uint8_t board_cards, uint8_t buckets) {
+    memset(header, 0, sizeof(BucketHeader));
+    memcpy(header->magic, BUCKETS_MAGIC, sizeof(BUCKETS_MAGIC));
+    header->version = BUCKETS_VERSION;
+    header->board_cards = board_cards;
+    header->buckets = buckets;
+    header->bits = 1;
+    while((1u << header->bits) < buckets) {
+        header->bits++;
+    }
+    uint32_t left = DECK_SIZE - board_cards;
+    header->holes = left * (left - 1) / 2;
+}
+
+bool buckets_header_valid(const BucketHeader* header) {
+    uint32_t left = DECK_SIZE - header->board_cards;
+    return memcmp(header->magic, BUCKETS_MAGIC, sizeof(BUCKETS_MAGIC)) == 0 &&
+           header->version == BUCKETS_VERSION &&
+           (header->board_cards == 0 || (header->board_cards >= 3 && header->board_cards <= 5)) &&
+           header->holes == left * (left - 1) / 2 && header->bits >= 1 && header->bits <= 4 &&
+           header->buckets >= 1 && header->buckets <= BUCKETS_MAX &&
+           header->buckets <= (1u << header->bits);
+}
+
+// Table read through a source: only the header is loaded, lookups read the
+// boards they probe and the entry's two bytes
+bool buckets_open(BucketTable* table, BucketSource source, void* context) {
+    memset(table, 0, sizeof(BucketTable));
+    if(!source(context, 0, &table->header, sizeof(BucketHeader))) return false;
+    if(!buckets_header_valid(&table->header)) return false;
+    table->source = source;
+    table->context = context;
+    return true;
+}
+
+static bool buckets_board(const BucketTable* table, uint32_t index, uint64_t* board) {
+    if(table->boards) {
+        *board = table->boards[index];
+        return true;
+    }
+    uint32_t offset = sizeof(BucketHeader) + index * sizeof(uint64_t);
+    return table->source(table->context, offset, board, sizeof(uint64_t));
+}
+
+#ifdef HOLDEM_HOST
+// C(n, k) for the k of a board (1-5), zero when n < k
+static uint32_t buckets_choose(uint32_t n, uint8_t k) {
+    switch(k) {
+        case 1:
+            return n;
+        case 2:
+            return n * (n - 1) / 2;
+        case 3:
+            return n * (n - 1) * (n - 2) / 6;
+        case 4:
+            return n * (n - 1) * (n - 2) * (n - 3) / 24;
+        default:
+            return n * (n - 1) * (n - 2) * (n - 3) * (n - 4) / 120;
+    }
+}
+
+// Colex rank of a set of cards among all sets of its size
+static uint32_t buckets_colex_rank(CardSet cards) {
+    uint32_t rank = 0;
+    for(uint8_t i = 1; cards; i++, cards &= cards - 1) {
+        rank += buckets_choose((uint32_t)__builtin_ctzll(cards), i);
+    }
+    return rank;
+}
+#endif
+
+// Position of a canonical board in the table, or board_count if missing
+static uint32_t buckets_find_board(const BucketTable* table, CardSet canonical) {
+    const BucketHeader* header = &table->header;
+#ifdef HOLDEM_HOST
+    if(table->directory) {
+        uint32_t position = table->directory[buckets_colex_rank(canonical)];
+        return position ? position - 1 : header->board_count;
+    }
+#endif
+
+    uint32_t low = 0;
+    uint32_t high = header->board_count;
+    uint64_t probe;
+    while(low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        if(!buckets_board(table, middle, &probe)) return header->board_count;
+        if(probe < canonical) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if(low == header->board_count || !buckets_board(table, low, &probe) || probe != canonical) {
+        return header->board_count;
+    }
+    return low;
+}
+
+// Bucket of `hole` on `board` (as many cards as the table's street), or
+// BUCKETS_NONE for a malformed hand or a failed read
+uint8_t buckets_lookup(const BucketTable* table, CardSet hole, CardSet board) {
+    const BucketHeader* header = &table->header;
+    if(poker_set_count(board) != header->board_cards || poker_set_count(hole) != HAND_SIZE ||
+       (hole & board)) {
+        return BUCKETS_NONE;
+    }
+    CardSet canonical = buckets_canonical(board, &hole);
+    uint32_t position = buckets_find_board(table, canonical);
+    if(position == header->board_count) return BUCKETS_NONE;
+
+    uint64_t bit = ((uint64_t)position * header->holes + buckets_hole_index(hole, canonical)) * header->bits;
+    uint8_t bytes[2];
+    if(table->packed) {
+        bytes[0] = table->packed[bit / 8];
+        bytes[1] = table->packed[bit / 8 + 1];
+    } else {
+        uint32_t offset = sizeof(BucketHeader) + header->board_count * sizeof(uint64_t) + (uint32_t)(bit / 8);
+        if(!table->source(table->context, offset, bytes, sizeof(bytes))) return BUCKETS_NONE;
+    }
+    return ((bytes[0] | bytes[1] << 8) >> (bit % 8)) & ((1u << header->bits) - 1);
+}
+
+#ifdef HOLDEM_HOST
+const char* const buckets_street_names[BUCKETS_STREETS] = {"preflop", "flop", "turn", "river"};
+
+bool buckets_map_open(BucketTable* table, const char* path) {
+    memset(table, 0, sizeof(BucketTable));
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return false;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(BucketHeader)) {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) return false;
+
+    const BucketHeader* header = (const BucketHeader*)data;
+    if(!buckets_header_valid(header) ||
+       (uint64_t)st.st_size !=
+           sizeof(BucketHeader) + header->board_count * sizeof(uint64_t) + buckets_packed_size(header)) {
+        munmap(data, (size_t)st.st_size);
+        return false;
+    }
+
+    // Lookups hit one board list page and one entry each
+    madvise(data, (size_t)st.st_size, MADV_RANDOM);
+
+    table->header = *header;
+    table->boards = (const uint64_t*)((const uint8_t*)data + sizeof(BucketHeader));
+    table->packed = (const uint8_t*)(table->boards + header->board_count);
+    table->map = data;
+    table->map_size = (size_t)st.st_size;
+
+    uint32_t sets = 1;
+    for(uint8_t i = 0; i < header->board_cards; i++) {
+        sets = sets * (DECK_SIZE - i) / (i + 1);
+    }
+    table->directory = calloc(sets, sizeof(uint32_t));
+    if(!table->directory) {
+        buckets_map_close(table);
+        return false;
+    }
+    for(uint32_t i = 0; i < header->board_count; i++) {
+        table->directory[buckets_colex_rank(table->boards[i])] = i + 1;
+    }
+    return true;
+}
+
+void buckets_map_close(BucketTable* table) {
+    if(table->map) {
+        munmap(table->map, table->map_size);
+    }
+    free(table->directory);
+    memset(table, 0, sizeof(BucketTable));
+}
+
+// Maps all four streets' tables from a holdem-buckets output directory
+bool buckets_map_streets(BucketTable* tables, const char* dir) {
+    for(uint8_t street = 0; street < BUCKETS_STREETS; street++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s.bkt", dir, buckets_street_names[street]);
+        bool mapped = buckets_map_open(&tables[street], path) &&
+                      tables[street].header.board_cards == (street ? street + 2 : 0);
+        if(!mapped) {
+            for(uint8_t i = 0; i <= street; i++) {
+                buckets_map_close(&tables[i]);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+#endif
\ No newline at end of file
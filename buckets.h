@@ -0,0 +1,83 @@
+#pragma once
+
+#include "poker.h"
+
+// Card abstraction tables: the strength bucket of every (hole, board) on one
+// street, generated on the host by host/holdem_buckets.c (holdem-buckets).
+// Hands are clustered by expected hand strength against one random hand
+// (EHS, with the rest of the board still to come) and its square (EHS^2,
+// which separates draws from made hands of the same EHS). Buckets are
+// numbered by ascending EHS.
+//
+// A table file is a BucketHeader, the street's canonical boards and the
+// packed buckets:
+//   BucketHeader
+//   uint64_t boards[board_count]   CardSets, ascending
+//   packed[board_count * holes]    `bits` bits per entry, LSB first
+// Boards are canonical under suit relabelling (buckets_canonical), which
+// leaves 1, 1755, 16432 and 134459 boards per street instead of up to
+// 2.6 million. Each board has one entry per hole pair from the cards left,
+// in colex order (buckets_hole_index). Multi-byte fields are little-endian,
+// like hand histories.
+//
+// The host maps the file (buckets_map_open) and looks entries up in place,
+// finding the board through a directory indexed by its colex rank (10 MB
+// for the river) instead of a binary search.
+// The device keeps it on the SD card and reads only the probed boards and
+// the one entry through a BucketSource (buckets_open).
+
+#define BUCKETS_MAGIC "HLDMBKT"
+#define BUCKETS_VERSION 1
+#define BUCKETS_MAX 16
+#define BUCKETS_NONE 0xFF
+#define BUCKETS_STREETS 4 // Preflop, flop, turn, river
+
+typedef struct {
+    char magic[8]; // BUCKETS_MAGIC, NUL terminated
+    uint32_t version;
+    uint32_t board_count;
+    uint32_t holes; // Entries per board
+    uint8_t board_cards; // 0, 3, 4 or 5
+    uint8_t buckets;
+    uint8_t bits; // Bits per entry
+    uint8_t reserved;
+    float centroids[BUCKETS_MAX][2]; // EHS and EHS^2 of each bucket
+} BucketHeader;
+
+_Static_assert(sizeof(BucketHeader) == 152, "bucket header layout");
+
+// Reads `size` bytes at `offset` of a table file
+typedef bool (*BucketSource)(void* context, uint32_t offset, void* buffer, size_t size);
+
+typedef struct {
+    BucketHeader header;
+    const uint64_t* boards; // In memory (mapped), or NULL to read through source
+    const uint8_t* packed;
+    BucketSource source;
+    void* context;
+    void* map;
+    size_t map_size;
+    uint32_t* directory; // Host: board position + 1 by colex rank, 0 = none
+} BucketTable;
+
+// Byte size of the packed entries; one spare byte lets lookups always
+// read two bytes
+static inline uint64_t buckets_packed_size(const BucketHeader* header) {
+    return ((uint64_t)header->board_count * header->holes * header->bits + 7) / 8 + 1;
+}
+
+// Function declarations
+CardSet buckets_canonical(CardSet board, CardSet* hole);
+uint32_t buckets_hole_index(CardSet hole, CardSet board);
+void buckets_header_init(BucketHeader* header, uint8_t board_cards, uint8_t buckets);
+bool buckets_header_valid(const BucketHeader* header);
+bool buckets_open(BucketTable* table, BucketSource source, void* context);
+uint8_t buckets_lookup(const BucketTable* table, CardSet hole, CardSet board);
+#ifdef HOLDEM_HOST
+// Street names, also the table file names (<name>.bkt)
+extern const char* const buckets_street_names[BUCKETS_STREETS];
+
+bool buckets_map_open(BucketTable* table, const char* path);
+void buckets_map_close(BucketTable* table);
+bool buckets_map_streets(BucketTable* tables, const char* dir);
+#endif
\ No newline at end of file
@@ -0,0 +1,429 @@
+#include "engine.h"
+#include "profile.h"
+#include "trace.h"
+#include <string.h>
+
+// A player can still make decisions this hand
+static bool engine_can_act(Player* player) {
+    return !player->folded && !player->all_in;
+}
+
+// Next seat after `from` that can act, or MAX_PLAYERS if nobody can
+static uint8_t engine_next_seat(GameState* game, uint8_t from) {
+    for(uint8_t i = 1; i <= MAX_PLAYERS; i++) {
+        uint8_t seat = (from + i) % MAX_PLAYERS;
+        if(engine_can_act(&game->players[seat])) {
+            return seat;
+        }
+    }
+    return MAX_PLAYERS;
+}
+
+// Next seat after `from` that still has chips (or is live in this hand)
+static uint8_t engine_next_live_seat(GameState* game, uint8_t from) {
+    for(uint8_t i = 1; i <= MAX_PLAYERS; i++) {
+        uint8_t seat = (from + i) % MAX_PLAYERS;
+        if(!game->players[seat].folded) {
+            return seat;
+        }
+    }
+    return from;
+}
+
+static uint8_t engine_count_can_act(GameState* game) {
+    uint8_t count = 0;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(engine_can_act(&game->players[i])) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Move chips from a player's stack into their current bet, capped at all-in
+static uint32_t engine_commit(Player* player, uint32_t amount) {
+    if(amount >= player->chips) {
+        amount = player->chips;
+        player->all_in = true;
+    }
+    player->bet += amount;
+    player->committed += amount;
+    player->chips -= amount;
+    return amount;
+}
+
+static void engine_update_pot(GameState* game) {
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        game->pot += game->players[i].bet;
+        game->players[i].bet = 0;
+    }
+    game->current_bet = 0;
+}
+
+static void engine_deal_cards(GameState* game) {
+    // Deal two hole cards to each player still in the game
+    for(uint8_t i = 0; i < HAND_SIZE; i++) {
+        for(uint8_t j = 0; j < MAX_PLAYERS; j++) {
+            Player* player = &game->players[j];
+            if(!player->folded) {
+                player->hand[i] = poker_deal_card(&game->deck);
+                player->hand_set |= poker_card_bit(player->hand[i]);
+            }
+        }
+    }
+}
+
+static void engine_post_blinds(GameState* game) {
+    if(game->blinds_posted) return;
+
+    engine_commit(&game->players[game->small_blind_pos], SMALL_BLIND);
+    engine_commit(&game->players[game->big_blind_pos], BIG_BLIND);
+
+    game->current_bet = game->players[game->big_blind_pos].bet;
+    if(game->current_bet < game->players[game->small_blind_pos].bet) {
+        game->current_bet = game->players[game->small_blind_pos].bet;
+    }
+    game->blinds_posted = true;
+}
+
+// Called after every action: pass the turn or close the betting round
+static void engine_advance(GameState* game) {
+    if(game->active_players <= 1) {
+        // Everybody else folded, the last player standing takes the pot
+        engine_update_pot(game);
+        game->phase = PHASE_SHOWDOWN;
+        return;
+    }
+
+    if(!engine_is_betting_complete(game)) {
+        game->current_player = engine_next_seat(game, game->current_player);
+        return;
+    }
+
+    engine_update_pot(game);
+    engine_next_phase(game);
+}
+
+void engine_init(GameState* game, uint64_t seed) {
+    memset(game, 0, sizeof(GameState));
+    game->seed = seed;
+
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        game->players[i].chips = STARTING_CHIPS;
+        game->players[i].last_action = ACTION_CHECK;
+    }
+
+    game->phase = PHASE_PREFLOP;
+    game->active_players = MAX_PLAYERS;
+}
+
+void engine_new_hand(GameState* game) {
+    PROFILE_SCOPE(PROFILE_ENGINE_NEW_HAND);
+    TRACE_SCOPE(TRACE_DEAL);
+
+    // Reset for new hand; players without chips sit out as folded
+    game->active_players = 0;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        Player* player = &game->players[i];
+        player->bet = 0;
+        player->committed = 0;
+        player->folded = player->chips == 0;
+        player->all_in = false;
+        player->acted = false;
+        player->last_action = ACTION_CHECK;
+        player->hand_set = 0;
+        if(!player->folded) {
+            game->active_players++;
+        }
+    }
+
+    game->community_count = 0;
+    game->community_set = 0;
+    game->phase = PHASE_PREFLOP;
+    game->pot = 0;
+    game->current_bet = 0;
+    game->hand_number++;
+    game->blinds_posted = false;
+
+    // Move dealer button and set blind positions (heads-up: button posts small blind)
+    game->dealer = engine_next_live_seat(game, game->dealer);
+    if(game->active_players == 2) {
+        game->small_blind_pos = game->dealer;
+    } else {
+        game->small_blind_pos = engine_next_live_seat(game, game->dealer);
+    }
+    game->big_blind_pos = engine_next_live_seat(game, game->small_blind_pos);
+
+    // Initialize and shuffle deck; the deal only depends on (seed, hand number).
+    // Cards are drawn lazily, so a hand only pays for the cards it uses.
+    Rng deck_rng;
+    rng_seed_hand(&deck_rng, game->seed, game->hand_number, ENGINE_RNG_DECK);
+    rng_seed_hand(&game->rng, game->seed, game->hand_number, ENGINE_RNG_AI);
+    poker_init_deck(&game->deck);
+    poker_shuffle_deck_lazy(&game->deck, &deck_rng);
+
+    engine_deal_cards(game);
+    engine_post_blinds(game);
+
+    // Action starts with the player after the big blind
+    game->current_player = engine_next_seat(game, game->big_blind_pos);
+    if(game->current_player == MAX_PLAYERS) {
+        // Blinds put everybody all-in, run the board out
+        engine_update_pot(game);
+        engine_next_phase(game);
+    }
+}
+
+uint32_t engine_min_raise_to(GameState* game) {
+    uint32_t min_raise = game->current_bet * 2;
+    if(min_raise == 0) min_raise = BIG_BLIND; // Minimum bet if no current bet
+    return min_raise;
+}
+
+// Applies an action for the current player and moves the game on to the
+// next decision. Illegal actions are turned into the closest legal one
+// (check facing a bet calls, raises are clamped to min raise and all-in);
+// the action actually applied is returned.
+Action engine_apply_action(GameState* game, Action applied) {
+    PROFILE_SCOPE(PROFILE_ENGINE_ACTION);
+    Player* player = &game->players[game->current_player];
+    uint32_t call_amount = game->current_bet - player->bet;
+    PlayerAction action = applied.type;
+    uint32_t raise_to = applied.amount;
+
+    // Normalize the action against what is actually legal right now
+    if(action == ACTION_CHECK && call_amount > 0) action = ACTION_CALL;
+    if(action == ACTION_CALL && call_amount == 0) action = ACTION_CHECK;
+    if(action == ACTION_RAISE) {
+        uint32_t min_raise = engine_min_raise_to(game);
+        uint32_t max_raise = player->bet + player->chips;
+        if(raise_to < min_raise) raise_to = min_raise;
+        if(raise_to > max_raise) raise_to = max_raise;
+        if(raise_to <= game->current_bet) {
+            // Not enough chips to raise, this is a call (or check)
+            action = call_amount > 0 ? ACTION_CALL : ACTION_CHECK;
+        }
+    }
+
+    switch(action) {
+        case ACTION_FOLD:
+            player->folded = true;
+            game->active_players--;
+            break;
+
+        case ACTION_CHECK:
+            break;
+
+        case ACTION_CALL:
+            engine_commit(player, call_amount);
+            break;
+
+        case ACTION_RAISE:
+            engine_commit(player, raise_to - player->bet);
+            game->current_bet = player->bet;
+            // A raise reopens the action for everybody else
+            for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+                game->players[i].acted = false;
+            }
+            break;
+    }
+
+    player->last_action = action;
+    player->acted = true;
+    applied.type = action;
+    applied.amount = action == ACTION_RAISE ? raise_to : 0;
+
+    engine_advance(game);
+
+    return applied;
+}
+
+// Distinct legal actions of the current player, in increasing commitment:
+// fold (only when facing a bet; folding for free is never better than
+// checking), check or call, then raises to the minimum, to the pot and
+// all-in when the stack allows. Returns the count, at most ENGINE_MAX_ACTIONS.
+uint8_t engine_legal_actions(GameState* game, Action* actions) {
+    Player* player = &game->players[game->current_player];
+    uint32_t call_amount = game->current_bet - player->bet;
+    uint32_t max_raise = player->bet + player->chips;
+    uint8_t count = 0;
+
+    if(game->phase == PHASE_SHOWDOWN || !engine_can_act(player)) return 0;
+
+    if(call_amount > 0) {
+        actions[count++] = (Action){ACTION_FOLD, 0};
+        actions[count++] = (Action){ACTION_CALL, 0};
+    } else {
+        actions[count++] = (Action){ACTION_CHECK, 0};
+    }
+
+    if(max_raise <= game->current_bet) return count;
+
+    // Pot-sized raise: call, then raise by everything in the middle
+    uint32_t in_pot = game->pot;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        in_pot += game->players[i].bet;
+    }
+    uint32_t sizes[3] = {engine_min_raise_to(game), game->current_bet + in_pot + call_amount, max_raise};
+
+    uint32_t last = 0;
+    for(uint8_t i = 0; i < 3; i++) {
+        uint32_t raise_to = sizes[i] < max_raise ? sizes[i] : max_raise;
+        if(raise_to > last) {
+            actions[count++] = (Action){ACTION_RAISE, raise_to};
+            last = raise_to;
+        }
+    }
+
+    return count;
+}
+
+bool engine_is_betting_complete(GameState* game) {
+    // Every player who can still act must have acted and matched the bet
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        Player* player = &game->players[i];
+        if(engine_can_act(player) && (!player->acted || player->bet < game->current_bet)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void engine_next_phase(GameState* game) {
+    // Deal streets until somebody has a decision to make or we reach showdown
+    do {
+        switch(game->phase) {
+            case PHASE_PREFLOP:
+                // Deal flop (3 cards)
+                for(uint8_t i = 0; i < 3; i++) {
+                    game->community[i] = poker_deal_card(&game->deck);
+                    game->community_set |= poker_card_bit(game->community[i]);
+                }
+                game->community_count = 3;
+                game->phase = PHASE_FLOP;
+                break;
+
+            case PHASE_FLOP:
+                // Deal turn (1 card)
+                game->community[3] = poker_deal_card(&game->deck);
+                game->community_set |= poker_card_bit(game->community[3]);
+                game->community_count = 4;
+                game->phase = PHASE_TURN;
+                break;
+
+            case PHASE_TURN:
+                // Deal river (1 card)
+                game->community[4] = poker_deal_card(&game->deck);
+                game->community_set |= poker_card_bit(game->community[4]);
+                game->community_count = 5;
+                game->phase = PHASE_RIVER;
+                break;
+
+            case PHASE_RIVER:
+            case PHASE_SHOWDOWN:
+                game->phase = PHASE_SHOWDOWN;
+                break;
+        }
+    } while(game->phase != PHASE_SHOWDOWN && engine_count_can_act(game) < 2);
+
+    if(game->phase == PHASE_SHOWDOWN) return;
+
+    // Reset for new betting round - start with player after dealer
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        game->players[i].acted = false;
+    }
+    game->current_player = engine_next_seat(game, game->dealer);
+}
+
+// Splits the hand's chips without changing the game, so a search can score a
+// position it reached. The part of the biggest contribution that nobody
+// matched goes back to its owner. The rest is paid in layers: each layer holds
+// everybody's chips up to the next smallest contribution of a player still
+// in, and goes to the best hands among the players who put in that much.
+// Chips a folded player put in above every live player join the top layer.
+// Odd chips of a split go to the first winner in seat order.
+void engine_payout(const GameState* game, ShowdownResult* result) {
+    uint32_t committed[MAX_PLAYERS];
+    uint16_t strength[MAX_PLAYERS] = {0};
+    uint8_t top = 0;
+    uint32_t matched = 0, top_live = 0;
+
+    memset(result, 0, sizeof(ShowdownResult));
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        committed[i] = game->players[i].committed;
+        if(committed[i] > committed[top]) top = i;
+    }
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(i != top && committed[i] > matched) matched = committed[i];
+    }
+    result->returned[top] = committed[top] - matched;
+    committed[top] = matched;
+
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        const Player* player = &game->players[i];
+        result->pot += committed[i];
+        if(player->folded) continue;
+        // Everybody else folded: no need to look at the cards
+        strength[i] = game->active_players > 1 ?
+                          poker_hand_rank_u16(player->hand_set | game->community_set) :
+                          1;
+        if(committed[i] > top_live) top_live = committed[i];
+    }
+
+    uint32_t paid = 0;
+    while(paid < top_live) {
+        uint32_t level = top_live;
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            if(strength[i] && committed[i] > paid && committed[i] < level) level = committed[i];
+        }
+
+        uint32_t layer = 0;
+        uint16_t best = 0;
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            uint32_t in_layer = level == top_live || committed[i] < level ? committed[i] : level;
+            if(in_layer > paid) layer += in_layer - paid;
+            if(committed[i] >= level && strength[i] > best) best = strength[i];
+        }
+
+        uint8_t winner_count = 0;
+        uint8_t first = MAX_PLAYERS;
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            if(committed[i] >= level && strength[i] == best) {
+                if(first == MAX_PLAYERS) first = i;
+                winner_count++;
+            }
+        }
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            if(committed[i] >= level && strength[i] == best) result->won[i] += layer / winner_count;
+        }
+        result->won[first] += layer % winner_count;
+        paid = level;
+    }
+
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(result->won[i]) result->winners[result->winner_count++] = i;
+    }
+}
+
+// Pays out a finished hand (see engine_payout); returns the number of seats
+// that collected
+uint8_t engine_showdown(GameState* game, ShowdownResult* result) {
+    TRACE_SCOPE(TRACE_SHOWDOWN);
+    game->phase = PHASE_SHOWDOWN;
+    engine_payout(game, result);
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        game->players[i].chips += result->won[i] + result->returned[i];
+    }
+    game->pot = 0;
+    return result->winner_count;
+}
+
+uint8_t engine_players_with_chips(GameState* game) {
+    uint8_t count = 0;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(game->players[i].chips > 0) {
+            count++;
+        }
+    }
+    return count;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "poker.h"
+
+// Betting state machine shared by the Flipper app and the host simulator.
+// Nothing in here touches furi, the GUI or notifications: callers apply an
+// action and then look at GameState (current_player / phase) to decide what
+// to present next.
+
+// Most actions engine_legal_actions can return: fold, check/call and three
+// raise sizes (minimum, pot, all-in)
+#define ENGINE_MAX_ACTIONS 5
+
+// Random streams derived from (seed, hand_number), see rng_seed_hand
+#define ENGINE_RNG_DECK 0
+#define ENGINE_RNG_AI 1
+
+// Payout of a finished hand, see engine_payout
+typedef struct {
+    uint32_t won[MAX_PLAYERS]; // Chips collected from the pot(s)
+    uint32_t returned[MAX_PLAYERS]; // Part of a bet nobody matched, given back
+    uint32_t pot; // Chips contested, without the returned ones
+    uint8_t winners[MAX_PLAYERS]; // Seats that collected, in seat order
+    uint8_t winner_count;
+} ShowdownResult;
+
+// Function declarations
+void engine_init(GameState* game, uint64_t seed);
+void engine_new_hand(GameState* game);
+Action engine_apply_action(GameState* game, Action action);
+uint8_t engine_legal_actions(GameState* game, Action* actions);
+uint32_t engine_min_raise_to(GameState* game);
+bool engine_is_betting_complete(GameState* game);
+void engine_next_phase(GameState* game);
+void engine_payout(const GameState* game, ShowdownResult* result);
+uint8_t engine_showdown(GameState* game, ShowdownResult* result);
+uint8_t engine_players_with_chips(GameState* game);
\ No newline at end of file
@@ -0,0 +1,329 @@
+#include "equity.h"
+#include "platform.h"
+#include <math.h>
+#include <string.h>
+
+#if PLATFORM_HAS_THREADS
+#include <pthread.h>
+#define EQUITY_MAX_THREADS 64
+#else
+#define EQUITY_MAX_THREADS 1
+#endif
+
+// Rollouts between clock reads when a time budget is set
+#define EQUITY_TIME_CHECK_MASK 0xFF
+// Below this many rollouts per thread, extra threads cost more than they save
+#define EQUITY_MIN_ITERATIONS_PER_THREAD 2048
+
+// One rollout worker; owns its deck and random stream, shares nothing
+typedef struct {
+    CardSet hole;
+    CardSet board;
+    uint8_t opponents;
+    uint32_t quota; // 0 = run until the deadline
+    uint64_t deadline_us; // 0 = no deadline
+    Rng rng;
+
+    uint32_t done;
+    uint32_t wins;
+    uint32_t ties;
+    double share_sum;
+    double share_sq_sum;
+} EquityWorker;
+
+static void equity_run_worker(EquityWorker* worker) {
+    Deck deck;
+    poker_init_deck(&deck);
+    poker_deck_remove(&deck, worker->hole | worker->board);
+    poker_shuffle_deck_lazy(&deck, &worker->rng);
+
+    // Rewinding to here keeps the undealt cards a uniform permutation, so
+    // every rollout is a fresh partial Fisher-Yates draw with no reset cost
+    uint8_t base_top = deck.top;
+    CardSet base_dealt = deck.dealt;
+    uint8_t board_missing = COMMUNITY_SIZE - poker_set_count(worker->board);
+
+    while(worker->quota == 0 || worker->done < worker->quota) {
+        if(worker->deadline_us && (worker->done & EQUITY_TIME_CHECK_MASK) == 0 &&
+           platform_time_us() >= worker->deadline_us) {
+            break;
+        }
+
+        deck.top = base_top;
+        deck.dealt = base_dealt;
+
+        CardSet board = worker->board;
+        for(uint8_t i = 0; i < board_missing; i++) {
+            board |= poker_card_bit(poker_deal_card(&deck));
+        }
+
+        uint16_t hero = poker_hand_rank_u16(worker->hole | board);
+        uint8_t tied = 0;
+        bool lost = false;
+        for(uint8_t i = 0; i < worker->opponents && !lost; i++) {
+            CardSet opponent = poker_card_bit(poker_deal_card(&deck));
+            opponent |= poker_card_bit(poker_deal_card(&deck));
+            uint16_t strength = poker_hand_rank_u16(opponent | board);
+            if(strength > hero) {
+                lost = true;
+            } else if(strength == hero) {
+                tied++;
+            }
+        }
+
+        worker->done++;
+        if(lost) continue;
+
+        double share = 1.0 / (tied + 1);
+        if(tied) {
+            worker->ties++;
+        } else {
+            worker->wins++;
+        }
+        worker->share_sum += share;
+        worker->share_sq_sum += share * share;
+    }
+}
+
+#if PLATFORM_HAS_THREADS
+static void* equity_thread(void* ctx) {
+    equity_run_worker((EquityWorker*)ctx);
+    return NULL;
+}
+#endif
+
+EquityResult equity_monte_carlo(CardSet hole, CardSet board, uint8_t opponents, const EquityBudget* budget) {
+    EquityResult result = {0};
+    EquityWorker workers[EQUITY_MAX_THREADS];
+    uint32_t iterations = budget->max_iterations;
+
+    if(iterations == 0 && budget->max_time_us == 0) {
+        iterations = EQUITY_DEFAULT_ITERATIONS;
+    }
+
+    uint8_t threads = budget->threads ? budget->threads : platform_cpu_count();
+    if(threads > EQUITY_MAX_THREADS) threads = EQUITY_MAX_THREADS;
+    if(iterations && iterations / threads < EQUITY_MIN_ITERATIONS_PER_THREAD) {
+        threads = iterations / EQUITY_MIN_ITERATIONS_PER_THREAD;
+        if(threads == 0) threads = 1;
+    }
+
+    Rng root;
+    rng_seed(&root, budget->seed, 0);
+    uint64_t deadline = budget->max_time_us ? platform_time_us() + budget->max_time_us : 0;
+
+    for(uint8_t i = 0; i < threads; i++) {
+        EquityWorker* worker = &workers[i];
+        memset(worker, 0, sizeof(EquityWorker));
+        worker->hole = hole;
+        worker->board = board;
+        worker->opponents = opponents;
+        worker->quota = iterations / threads + (i < iterations % threads ? 1 : 0);
+        worker->deadline_us = deadline;
+        rng_split(&root, &worker->rng);
+    }
+
+#if PLATFORM_HAS_THREADS
+    pthread_t handles[EQUITY_MAX_THREADS];
+    uint8_t started = 1;
+    for(uint8_t i = 1; i < threads; i++) {
+        if(pthread_create(&handles[i], NULL, equity_thread, &workers[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+    // A thread that failed to start is not counted; its quota is simply lost
+    threads = started;
+    equity_run_worker(&workers[0]);
+    for(uint8_t i = 1; i < threads; i++) {
+        pthread_join(handles[i], NULL);
+    }
+#else
+    equity_run_worker(&workers[0]);
+#endif
+
+    uint32_t wins = 0, ties = 0;
+    double share_sum = 0, share_sq_sum = 0;
+    for(uint8_t i = 0; i < threads; i++) {
+        result.iterations += workers[i].done;
+        wins += workers[i].wins;
+        ties += workers[i].ties;
+        share_sum += workers[i].share_sum;
+        share_sq_sum += workers[i].share_sq_sum;
+    }
+
+    if(result.iterations > 0) {
+        double n = result.iterations;
+        double mean = share_sum / n;
+        double variance = share_sq_sum / n - mean * mean;
+        if(variance < 0) variance = 0;
+        result.win = (float)(wins / n);
+        result.tie = (float)(ties / n);
+        result.equity = (float)mean;
+        result.ci95 = (float)(1.96 * sqrt(variance / n));
+    }
+
+    return result;
+}
+
+static uint32_t equity_choose(uint8_t n, uint8_t k) {
+    uint32_t value = 1;
+    if(k > n) return 0;
+    for(uint8_t i = 0; i < k; i++) {
+        value = value * (n - i) / (i + 1);
+    }
+    return value;
+}
+
+uint32_t equity_exact_matchups(CardSet hole, CardSet board, uint16_t range_size) {
+    uint8_t unknown = DECK_SIZE - poker_set_count(hole | board);
+    uint8_t missing = COMMUNITY_SIZE - poker_set_count(board);
+    uint32_t opponents = range_size ? range_size : equity_choose(unknown - missing, HAND_SIZE);
+    uint64_t matchups = (uint64_t)equity_choose(unknown, missing) * opponents;
+    return matchups > UINT32_MAX ? UINT32_MAX : (uint32_t)matchups;
+}
+
+// Suits whose hole cards and board cards have the same ranks (typically
+// suits that appear nowhere yet) are interchangeable: swapping them maps
+// every runout to one with the same equity. Only runouts whose per-suit
+// masks are non-increasing within each such class are evaluated, weighted
+// by how many runouts they stand for.
+// Returns 0 for runouts that are not the canonical member of their class.
+static uint32_t equity_runout_weight(CardSet runout, const uint8_t* suit_class) {
+    uint32_t masks[4];
+    for(uint8_t suit = 0; suit < 4; suit++) {
+        masks[suit] = poker_suit_mask(runout, (CardSuit)suit);
+    }
+
+    uint32_t weight = 1;
+    for(uint8_t suit = 0; suit < 4; suit++) {
+        if(suit_class[suit] != suit) continue;
+
+        // Walk the class in suit order: class size and runs of equal masks
+        uint8_t size = 0, run = 0;
+        uint32_t previous = 0;
+        uint32_t divisor = 1;
+        for(uint8_t other = suit; other < 4; other++) {
+            if(suit_class[other] != suit) continue;
+            if(size > 0 && masks[other] > previous) return 0;
+            run = (size > 0 && masks[other] == previous) ? run + 1 : 1;
+            divisor *= run;
+            previous = masks[other];
+            size++;
+            weight *= size;
+        }
+        weight /= divisor;
+    }
+    return weight;
+}
+
+// Heads-up equity by full enumeration of the remaining board cards and of
+// the opponent's hand (every hand, or only those in `range`). Suit
+// isomorphism is only applied against a random hand, since an arbitrary
+// range is not symmetric in the suits.
+EquityResult equity_exact(CardSet hole, CardSet board, const CardSet* range, uint16_t range_size) {
+    EquityResult result = {0};
+    CardSet known = hole | board;
+    Card remaining[DECK_SIZE];
+    uint8_t remaining_count = 0;
+    uint8_t missing = COMMUNITY_SIZE - poker_set_count(board);
+    uint8_t suit_class[4];
+    uint8_t index[COMMUNITY_SIZE];
+    double win_weight = 0, tie_weight = 0, total_weight = 0;
+
+    for(Card card = 0; card < DECK_SIZE; card++) {
+        if(!(known & poker_card_bit(card))) {
+            remaining[remaining_count++] = card;
+        }
+    }
+
+    for(uint8_t suit = 0; suit < 4; suit++) {
+        suit_class[suit] = suit;
+        for(uint8_t other = 0; other < suit; other++) {
+            if(range == NULL &&
+               poker_suit_mask(hole, (CardSuit)other) == poker_suit_mask(hole, (CardSuit)suit) &&
+               poker_suit_mask(board, (CardSuit)other) == poker_suit_mask(board, (CardSuit)suit)) {
+                suit_class[suit] = suit_class[other];
+                break;
+            }
+        }
+    }
+
+    for(uint8_t i = 0; i < missing; i++) {
+        index[i] = i;
+    }
+
+    while(true) {
+        CardSet runout = 0;
+        for(uint8_t i = 0; i < missing; i++) {
+            runout |= poker_card_bit(remaining[index[i]]);
+        }
+
+        uint32_t weight = equity_runout_weight(runout, suit_class);
+        if(weight) {
+            CardSet full_board = board | runout;
+            CardSet dead = known | runout;
+            uint16_t hero = poker_hand_rank_u16(hole | full_board);
+            uint32_t wins = 0, ties = 0, total = 0;
+
+            if(range) {
+                for(uint16_t r = 0; r < range_size; r++) {
+                    if(range[r] & dead) continue;
+                    uint16_t villain = poker_hand_rank_u16(range[r] | full_board);
+                    wins += hero > villain;
+                    ties += hero == villain;
+                    total++;
+                }
+            } else {
+                for(uint8_t a = 0; a < remaining_count; a++) {
+                    CardSet first = poker_card_bit(remaining[a]);
+                    if(first & runout) continue;
+                    for(uint8_t b = a + 1; b < remaining_count; b++) {
+                        CardSet second = poker_card_bit(remaining[b]);
+                        if(second & runout) continue;
+                        uint16_t villain = poker_hand_rank_u16(first | second | full_board);
+                        wins += hero > villain;
+                        ties += hero == villain;
+                        total++;
+                    }
+                }
+            }
+
+            result.iterations += total;
+            win_weight += (double)weight * wins;
+            tie_weight += (double)weight * ties;
+            total_weight += (double)weight * total;
+        }
+
+        // Next combination of `missing` remaining cards
+        int8_t i = (int8_t)missing - 1;
+        while(i >= 0 && index[i] == remaining_count - missing + i) {
+            i--;
+        }
+        if(i < 0) break;
+        index[i]++;
+        for(uint8_t j = i + 1; j < missing; j++) {
+            index[j] = index[j - 1] + 1;
+        }
+    }
+
+    if(total_weight > 0) {
+        result.win = (float)(win_weight / total_weight);
+        result.tie = (float)(tie_weight / total_weight);
+        result.equity = (float)((win_weight + tie_weight * 0.5) / total_weight);
+    }
+    result.exact = true;
+    return result;
+}
+
+EquityResult equity_calculate(CardSet hole, CardSet board, uint8_t opponents, const EquityBudget* budget) {
+    bool exact = budget->mode == EQUITY_EXACT;
+    if(budget->mode == EQUITY_AUTO) {
+        exact = opponents == 1 && equity_exact_matchups(hole, board, 0) <= EQUITY_EXACT_MAX_MATCHUPS;
+    }
+
+    if(exact && opponents == 1) {
+        return equity_exact(hole, board, NULL, 0);
+    }
+    return equity_monte_carlo(hole, board, opponents, budget);
+}
\ No newline at end of file
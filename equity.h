@@ -0,0 +1,46 @@
+#pragma once
+
+#include "poker.h"
+
+// How equity_calculate gets its answer
+typedef enum {
+    EQUITY_AUTO = 0, // Exact when the enumeration is small enough, else Monte Carlo
+    EQUITY_MONTE_CARLO,
+    EQUITY_EXACT, // Heads-up only
+} EquityMode;
+
+// Work limits for an equity calculation. Whichever limit is hit first ends
+// the run; at least one of them must be set. Exact enumeration ignores them.
+typedef struct {
+    uint32_t max_iterations; // Total rollouts over all threads, 0 = no limit
+    uint32_t max_time_us; // Wall clock limit, 0 = no limit
+    uint8_t threads; // Worker threads, 0 = one per core (always 1 on device)
+    uint64_t seed; // Rollout seed; each thread gets its own stream
+    EquityMode mode;
+} EquityBudget;
+
+typedef struct {
+    float win; // Probability of winning outright
+    float tie; // Probability of splitting the pot
+    float equity; // Expected pot share (win + split shares)
+    float ci95; // Half-width of the 95% confidence interval of equity (0 when exact)
+    uint32_t iterations; // Rollouts run, or hand matchups evaluated when exact
+    bool exact;
+} EquityResult;
+
+// Rollouts when a budget sets no limit at all
+#define EQUITY_DEFAULT_ITERATIONS 400
+
+// Largest heads-up enumeration (runouts x opponent hands) EQUITY_AUTO will
+// choose over sampling: covers the flop on the host, turn and river on device
+#ifdef HOLDEM_HOST
+#define EQUITY_EXACT_MAX_MATCHUPS 2000000
+#else
+#define EQUITY_EXACT_MAX_MATCHUPS 50000
+#endif
+
+// Function declarations
+EquityResult equity_calculate(CardSet hole, CardSet board, uint8_t opponents, const EquityBudget* budget);
+EquityResult equity_monte_carlo(CardSet hole, CardSet board, uint8_t opponents, const EquityBudget* budget);
+EquityResult equity_exact(CardSet hole, CardSet board, const CardSet* range, uint16_t range_size);
+uint32_t equity_exact_matchups(CardSet hole, CardSet board, uint16_t range_size);
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "hand_history.h"
+#include "engine.h"
+#include <string.h>
+
+#ifdef HOLDEM_HOST
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Call right after engine_new_hand: blinds are posted, cards are dealt
+void hand_history_begin(HandRecord* record, const GameState* game) {
+    memset(record, 0, sizeof(HandRecord));
+    record->seed = game->seed;
+    record->hand_number = game->hand_number;
+    record->small_blind = SMALL_BLIND;
+    record->big_blind = BIG_BLIND;
+    record->dealer = game->dealer;
+    record->small_blind_pos = game->small_blind_pos;
+    record->big_blind_pos = game->big_blind_pos;
+    memset(record->hole, HAND_HISTORY_NO_CARD, sizeof(record->hole));
+    memset(record->board, HAND_HISTORY_NO_CARD, sizeof(record->board));
+    memset(record->street_start, HAND_HISTORY_NO_CARD, sizeof(record->street_start));
+
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        const Player* player = &game->players[i];
+        // Only the blinds are in front of the players yet
+        record->stacks[i] = (uint16_t)(player->chips + player->bet);
+        if(player->hand_set) {
+            memcpy(record->hole[i], player->hand, HAND_SIZE);
+        }
+    }
+}
+
+// `phase` is the street the action was taken on (GameState.phase before
+// engine_apply_action), `action` what engine_apply_action returned
+void hand_history_add_action(HandRecord* record, GamePhase phase, uint8_t seat, Action action) {
+    uint8_t recorded = record->action_count;
+
+    // Streets that start before this action begin here
+    for(uint8_t street = PHASE_FLOP; street <= phase && street <= PHASE_RIVER; street++) {
+        if(record->street_start[street - PHASE_FLOP] == HAND_HISTORY_NO_CARD) {
+            record->street_start[street - PHASE_FLOP] = recorded;
+        }
+    }
+
+    if(recorded == HAND_HISTORY_MAX_ACTIONS) {
+        record->flags |= HAND_HISTORY_FLAG_TRUNCATED;
+        return;
+    }
+    record->actions[recorded] = hand_history_pack_action(seat, action);
+    record->action_count++;
+}
+
+// Call right after engine_showdown with the pot and winners of its
+// ShowdownResult
+void hand_history_finish(
+    HandRecord* record,
+    const GameState* game,
+    uint32_t pot,
+    const uint8_t* winners,
+    uint8_t winner_count) {
+    memcpy(record->board, game->community, game->community_count);
+    for(uint8_t street = 0; street < 3; street++) {
+        if(record->street_start[street] == HAND_HISTORY_NO_CARD) {
+            record->street_start[street] = record->action_count;
+        }
+    }
+
+    record->pot = (uint16_t)pot;
+    for(uint8_t i = 0; i < winner_count; i++) {
+        record->winners |= 1 << winners[i];
+    }
+    if(game->active_players > 1) {
+        record->flags |= HAND_HISTORY_FLAG_SHOWDOWN;
+    }
+}
+
+void hand_history_header_init(HandHistoryHeader* header) {
+    memset(header, 0, sizeof(HandHistoryHeader));
+    memcpy(header->magic, HAND_HISTORY_MAGIC, sizeof(header->magic));
+    header->version = HAND_HISTORY_VERSION;
+    header->record_size = sizeof(HandRecord);
+}
+
+bool hand_history_header_valid(const HandHistoryHeader* header) {
+    return memcmp(header->magic, HAND_HISTORY_MAGIC, sizeof(header->magic)) == 0 &&
+           header->version == HAND_HISTORY_VERSION && header->record_size == sizeof(HandRecord);
+}
+
+void hand_history_writer_init(HandHistoryWriter* writer, HandHistorySink sink, void* context) {
+    writer->sink = sink;
+    writer->context = context;
+    writer->count = 0;
+    writer->failed = false;
+}
+
+// Only for a new (empty) file; appending to an existing one continues
+// after its header
+bool hand_history_write_header(HandHistoryWriter* writer) {
+    HandHistoryHeader header;
+    hand_history_header_init(&header);
+    if(!writer->failed && !writer->sink(writer->context, &header, sizeof(header))) {
+        writer->failed = true;
+    }
+    return !writer->failed;
+}
+
+bool hand_history_append(HandHistoryWriter* writer, const HandRecord* record) {
+    if(writer->failed) return false;
+
+    writer->buffer[writer->count++] = *record;
+    if(writer->count == HAND_HISTORY_BUFFER_RECORDS) {
+        return hand_history_flush(writer);
+    }
+    return true;
+}
+
+bool hand_history_flush(HandHistoryWriter* writer) {
+    if(writer->count && !writer->failed &&
+       !writer->sink(writer->context, writer->buffer, writer->count * sizeof(HandRecord))) {
+        writer->failed = true;
+    }
+    writer->count = 0;
+    return !writer->failed;
+}
+
+// Sets `game` up as the recorded hand started: same stacks, button and
+// deal. Applying the recorded actions with engine_apply_action then
+// replays the hand exactly (unless it was truncated).
+void hand_history_replay_start(const HandRecord* record, GameState* game) {
+    engine_init(game, record->seed);
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        game->players[i].chips = record->stacks[i];
+    }
+    // engine_new_hand advances the button and the hand number
+    game->dealer = (record->dealer + MAX_PLAYERS - 1) % MAX_PLAYERS;
+    game->hand_number = record->hand_number - 1;
+    engine_new_hand(game);
+}
+
+#ifdef HOLDEM_HOST
+bool hand_history_map_open(HandHistoryMap* map, const char* path) {
+    memset(map, 0, sizeof(HandHistoryMap));
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return false;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(HandHistoryHeader)) {
+        close(fd);
+        return false;
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) return false;
+
+    if(!hand_history_header_valid((const HandHistoryHeader*)data)) {
+        munmap(data, (size_t)st.st_size);
+        return false;
+    }
+
+    // Readers scan front to back; let the kernel read ahead aggressively
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    map->map = data;
+    map->map_size = (size_t)st.st_size;
+    map->records = (const HandRecord*)((const uint8_t*)data + sizeof(HandHistoryHeader));
+    map->count = (map->map_size - sizeof(HandHistoryHeader)) / sizeof(HandRecord);
+    return true;
+}
+
+void hand_history_map_close(HandHistoryMap* map) {
+    if(map->map) {
+        munmap(map->map, map->map_size);
+    }
+    memset(map, 0, sizeof(HandHistoryMap));
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "poker.h"
+
+// Append-only binary hand history: a 16-byte file header followed by one
+// fixed-size HandRecord per hand, so a file can be mapped and indexed like
+// an array. Multi-byte fields are little-endian (the Flipper and x86/ARM
+// hosts all are) and the layout has no padding, so records are read in
+// place without parsing.
+
+#define HAND_HISTORY_MAGIC "HLDMHIST"
+#define HAND_HISTORY_VERSION 1
+
+// Recorded actions per hand; a longer hand keeps its first actions and sets
+// HAND_HISTORY_FLAG_TRUNCATED (result, board and cards are still complete)
+#define HAND_HISTORY_MAX_ACTIONS 24
+
+#define HAND_HISTORY_NO_CARD 0xFF
+
+// HandRecord.flags
+#define HAND_HISTORY_FLAG_SHOWDOWN (1 << 0) // Two or more players showed down
+#define HAND_HISTORY_FLAG_TRUNCATED (1 << 1) // More than HAND_HISTORY_MAX_ACTIONS actions
+
+// Packed action: seat in bits 14-15, PlayerAction in bits 12-13 and the
+// raise-to amount (0 for other actions) in bits 0-11. All the chips in play
+// fit in 12 bits, as they do in the uint16_t stacks and pot below.
+#define HAND_HISTORY_AMOUNT_MASK 0x0FFF
+_Static_assert(MAX_PLAYERS * STARTING_CHIPS <= HAND_HISTORY_AMOUNT_MASK, "chips must fit a packed action");
+
+typedef struct {
+    char magic[8]; // HAND_HISTORY_MAGIC, not NUL terminated
+    uint16_t version;
+    uint16_t record_size; // sizeof(HandRecord)
+    uint32_t reserved;
+} HandHistoryHeader;
+
+typedef struct {
+    uint64_t seed; // GameState.seed: with hand_number, reproduces the deal
+    uint32_t hand_number;
+    uint16_t small_blind;
+    uint16_t big_blind;
+    uint16_t stacks[MAX_PLAYERS]; // Chips at the start of the hand, before blinds
+    uint16_t pot; // Chips contested, without an uncalled bet returned
+    uint8_t dealer;
+    uint8_t small_blind_pos;
+    uint8_t big_blind_pos;
+    uint8_t winners; // Bit per seat
+    uint8_t flags; // HAND_HISTORY_FLAG_*
+    uint8_t action_count; // Recorded actions, at most HAND_HISTORY_MAX_ACTIONS
+    Card hole[MAX_PLAYERS][HAND_SIZE]; // HAND_HISTORY_NO_CARD for seats sitting out
+    Card board[COMMUNITY_SIZE]; // HAND_HISTORY_NO_CARD for streets not dealt
+    // Index of the first flop, turn and river action; actions of a street
+    // run up to the next street's start (or action_count)
+    uint8_t street_start[3];
+    uint16_t actions[HAND_HISTORY_MAX_ACTIONS]; // See hand_history_pack_action
+} HandRecord;
+
+_Static_assert(sizeof(HandHistoryHeader) == 16, "hand history header layout");
+_Static_assert(sizeof(HandRecord) == 96, "hand history record layout");
+
+// Receives the bytes of a flushed buffer; returns false on a write error
+typedef bool (*HandHistorySink)(void* context, const void* data, size_t size);
+
+// Records gathered before each sink call. The host writes large batches,
+// the device a few records per SD card write.
+#ifdef HOLDEM_HOST
+#define HAND_HISTORY_BUFFER_RECORDS 4096
+#else
+#define HAND_HISTORY_BUFFER_RECORDS 8
+#endif
+
+typedef struct {
+    HandHistorySink sink;
+    void* context;
+    uint16_t count;
+    bool failed; // A sink call failed; later records are dropped
+    HandRecord buffer[HAND_HISTORY_BUFFER_RECORDS];
+} HandHistoryWriter;
+
+static inline uint16_t hand_history_pack_action(uint8_t seat, Action action) {
+    uint16_t amount = action.type == ACTION_RAISE ? (uint16_t)action.amount : 0;
+    return (uint16_t)(seat << 14 | action.type << 12 | (amount & HAND_HISTORY_AMOUNT_MASK));
+}
+
+static inline uint8_t hand_history_action_seat(uint16_t packed) {
+    return packed >> 14;
+}
+
+static inline Action hand_history_action(uint16_t packed) {
+    return (Action){(PlayerAction)((packed >> 12) & 3), packed & HAND_HISTORY_AMOUNT_MASK};
+}
+
+// Function declarations
+void hand_history_begin(HandRecord* record, const GameState* game);
+void hand_history_add_action(HandRecord* record, GamePhase phase, uint8_t seat, Action action);
+void hand_history_finish(
+    HandRecord* record,
+    const GameState* game,
+    uint32_t pot,
+    const uint8_t* winners,
+    uint8_t winner_count);
+void hand_history_header_init(HandHistoryHeader* header);
+bool hand_history_header_valid(const HandHistoryHeader* header);
+void hand_history_writer_init(HandHistoryWriter* writer, HandHistorySink sink, void* context);
+bool hand_history_write_header(HandHistoryWriter* writer);
+bool hand_history_append(HandHistoryWriter* writer, const HandRecord* record);
+bool hand_history_flush(HandHistoryWriter* writer);
+void hand_history_replay_start(const HandRecord* record, GameState* game);
+
+#ifdef HOLDEM_HOST
+// Read-only mapping of a history file; records[0..count) point straight
+// into the page cache. A torn record at the end (interrupted append) is
+// left out.
+typedef struct {
+    const HandRecord* records;
+    uint64_t count;
+    void* map;
+    size_t map_size;
+} HandHistoryMap;
+
+bool hand_history_map_open(HandHistoryMap* map, const char* path);
+void hand_history_map_close(HandHistoryMap* map);
+#endif
\ No newline at end of file
@@ -0,0 +1,463 @@
+#include "hand_text.h"
+#include "engine.h"
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Read size of the importer; a line longer than this is skipped
+#define HAND_TEXT_CHUNK (1 << 20)
+
+static const char* rank_names[] = {
+    "Deuce", "Three", "Four", "Five", "Six", "Seven", "Eight",
+    "Nine", "Ten", "Jack", "Queen", "King", "Ace"};
+static const char* rank_plurals[] = {
+    "Deuces", "Threes", "Fours", "Fives", "Sixes", "Sevens", "Eights",
+    "Nines", "Tens", "Jacks", "Queens", "Kings", "Aces"};
+static const char* street_names[] = {"FLOP", "TURN", "RIVER"};
+static const char* street_summary_names[] = {"before Flop", "on the Flop", "on the Turn", "on the River"};
+
+// "Ah", "Td": rank in upper case, suit in lower case
+static void hand_text_card(Card card, char* buffer) {
+    poker_get_card_string(card, buffer, 3);
+    buffer[1] = buffer[1] - 'A' + 'a';
+}
+
+static void hand_text_cards(FILE* out, const Card* cards, uint8_t count) {
+    char text[3];
+    fputc('[', out);
+    for(uint8_t i = 0; i < count; i++) {
+        hand_text_card(cards[i], text);
+        fprintf(out, i ? " %s" : "%s", text);
+    }
+    fputc(']', out);
+}
+
+// Description of a made hand as the layout writes it ("a pair of Queens",
+// "a full house, Kings full of Sevens")
+void hand_text_describe(CardSet cards, char* buffer, size_t buffer_size) {
+    Card best[COMMUNITY_SIZE];
+    uint8_t count = poker_best_five(cards, best);
+    uint8_t rank_count[13] = {0};
+    uint8_t high = 0, low = 12;
+
+    for(uint8_t i = 0; i < count; i++) {
+        uint8_t rank = poker_card_rank(best[i]) - RANK_2;
+        rank_count[rank]++;
+        if(rank > high) high = rank;
+        if(rank < low) low = rank;
+    }
+
+    // Most repeated rank first, ties to the higher rank
+    uint8_t primary = 0, secondary = 0, secondary_count = 0;
+    for(uint8_t rank = 0; rank < 13; rank++) {
+        if(rank_count[rank] >= rank_count[primary]) primary = rank;
+    }
+    for(uint8_t rank = 0; rank < 13; rank++) {
+        if(rank != primary && rank_count[rank] && rank_count[rank] >= secondary_count) {
+            secondary = rank;
+            secondary_count = rank_count[rank];
+        }
+    }
+
+    // Wheel: the ace plays low
+    if(high == RANK_ACE - RANK_2 && rank_count[RANK_5 - RANK_2] && low == 0) {
+        high = RANK_5 - RANK_2;
+        low = RANK_ACE - RANK_2;
+    }
+
+    switch(poker_evaluate_set(cards).rank) {
+        case HAND_HIGH_CARD:
+            snprintf(buffer, buffer_size, "high card %s", rank_names[high]);
+            break;
+        case HAND_PAIR:
+            snprintf(buffer, buffer_size, "a pair of %s", rank_plurals[primary]);
+            break;
+        case HAND_TWO_PAIR:
+            snprintf(buffer, buffer_size, "two pair, %s and %s", rank_plurals[primary], rank_plurals[secondary]);
+            break;
+        case HAND_THREE_KIND:
+            snprintf(buffer, buffer_size, "three of a kind, %s", rank_plurals[primary]);
+            break;
+        case HAND_STRAIGHT:
+            snprintf(buffer, buffer_size, "a straight, %s to %s", rank_names[low], rank_names[high]);
+            break;
+        case HAND_FLUSH:
+            snprintf(buffer, buffer_size, "a flush, %s high", rank_names[high]);
+            break;
+        case HAND_FULL_HOUSE:
+            snprintf(buffer, buffer_size, "a full house, %s full of %s", rank_plurals[primary], rank_plurals[secondary]);
+            break;
+        case HAND_FOUR_KIND:
+            snprintf(buffer, buffer_size, "four of a kind, %s", rank_plurals[primary]);
+            break;
+        case HAND_STRAIGHT_FLUSH:
+            snprintf(buffer, buffer_size, "a straight flush, %s to %s", rank_names[low], rank_names[high]);
+            break;
+        case HAND_ROYAL_FLUSH:
+            snprintf(buffer, buffer_size, "a Royal Flush");
+            break;
+    }
+}
+
+static void hand_text_street(FILE* out, const GameState* game, uint8_t street) {
+    uint8_t shown = street + 2; // Board before this street's card(s)
+    fprintf(out, "*** %s *** ", street_names[street]);
+    if(street == 0) {
+        hand_text_cards(out, game->community, 3);
+    } else {
+        hand_text_cards(out, game->community, shown);
+        fputc(' ', out);
+        hand_text_cards(out, &game->community[shown], 1);
+    }
+    fputc('\n', out);
+}
+
+// Writes one hand, replaying it through the engine to recover bet sizes,
+// all-ins and the payout. Truncated records cannot be replayed and are
+// skipped (returns false). Table and player names are fixed ("Player0" is
+// seat 0, the human seat on the device); the records carry no time, so
+// every hand gets the same timestamp.
+bool hand_text_export(FILE* out, const HandRecord* record) {
+    GameState game;
+    GamePhase folded_on[MAX_PLAYERS];
+    char description[48];
+
+    if(record->flags & HAND_HISTORY_FLAG_TRUNCATED) return false;
+    hand_history_replay_start(record, &game);
+
+    fprintf(out, "PokerStars Hand #%" PRIu32 ":  Hold'em No Limit (%u/%u) - 2000/01/01 00:00:00 ET\n",
+            record->hand_number, record->small_blind, record->big_blind);
+    fprintf(out, "Table 'Flipper' %u-max Seat #%u is the button\n", MAX_PLAYERS, record->dealer + 1);
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        folded_on[i] = PHASE_SHOWDOWN;
+        if(record->stacks[i]) {
+            fprintf(out, "Seat %u: Player%u (%u in chips)\n", i + 1, i, record->stacks[i]);
+        }
+    }
+    fprintf(out, "Player%u: posts small blind %" PRIu32 "\n",
+            game.small_blind_pos, game.players[game.small_blind_pos].bet);
+    fprintf(out, "Player%u: posts big blind %" PRIu32 "\n",
+            game.big_blind_pos, game.players[game.big_blind_pos].bet);
+    fprintf(out, "*** HOLE CARDS ***\n");
+    if(record->hole[0][0] != HAND_HISTORY_NO_CARD) {
+        fprintf(out, "Dealt to Player0 ");
+        hand_text_cards(out, record->hole[0], HAND_SIZE);
+        fputc('\n', out);
+    }
+
+    uint8_t streets_shown = 0;
+    for(uint8_t i = 0; i < record->action_count; i++) {
+        uint8_t seat = hand_history_action_seat(record->actions[i]);
+        Action action = hand_history_action(record->actions[i]);
+        Player* player = &game.players[seat];
+        uint32_t current_bet = game.current_bet;
+        // Bets are swept into the pot when the action closes the street
+        uint32_t to_call = current_bet - player->bet;
+        if(to_call > player->chips) to_call = player->chips;
+        GamePhase phase = game.phase;
+
+        // Street headers up to the one this action is on
+        while(streets_shown < phase) {
+            hand_text_street(out, &game, streets_shown++);
+        }
+
+        action = engine_apply_action(&game, action);
+        fprintf(out, "Player%u: ", seat);
+        switch(action.type) {
+            case ACTION_FOLD:
+                fprintf(out, "folds");
+                folded_on[seat] = phase;
+                break;
+            case ACTION_CHECK:
+                fprintf(out, "checks");
+                break;
+            case ACTION_CALL:
+                fprintf(out, "calls %" PRIu32, to_call);
+                break;
+            case ACTION_RAISE:
+                if(current_bet == 0) {
+                    fprintf(out, "bets %" PRIu32, action.amount);
+                } else {
+                    fprintf(out, "raises %" PRIu32 " to %" PRIu32, action.amount - current_bet, action.amount);
+                }
+                break;
+        }
+        fprintf(out, "%s\n", player->all_in && action.type != ACTION_FOLD ? " and is all-in" : "");
+    }
+
+    // The payout only depends on the cards and what everybody put in, so it
+    // is known before the run-out; an uncalled bet goes back first
+    ShowdownResult result;
+    engine_payout(&game, &result);
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(result.returned[i]) {
+            fprintf(out, "Uncalled bet (%" PRIu32 ") returned to Player%u\n", result.returned[i], i);
+        }
+    }
+
+    // Streets run out after the last action (all-in)
+    while(streets_shown < 3 && game.community_count > streets_shown + 2) {
+        hand_text_street(out, &game, streets_shown++);
+    }
+
+    bool showdown = game.active_players > 1;
+    if(showdown) {
+        fprintf(out, "*** SHOW DOWN ***\n");
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            if(game.players[i].folded) continue;
+            hand_text_describe(game.players[i].hand_set | game.community_set, description, sizeof(description));
+            fprintf(out, "Player%u: shows ", i);
+            hand_text_cards(out, game.players[i].hand, HAND_SIZE);
+            fprintf(out, " (%s)\n", description);
+        }
+    }
+
+    engine_showdown(&game, &result);
+    const uint32_t* won = result.won;
+    for(uint8_t i = 0; i < result.winner_count; i++) {
+        fprintf(out, "Player%u collected %" PRIu32 " from pot\n", result.winners[i], won[result.winners[i]]);
+    }
+
+    fprintf(out, "*** SUMMARY ***\n");
+    fprintf(out, "Total pot %" PRIu32 " | Rake 0\n", result.pot);
+    if(game.community_count) {
+        fprintf(out, "Board ");
+        hand_text_cards(out, game.community, game.community_count);
+        fputc('\n', out);
+    }
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(!record->stacks[i]) continue;
+        fprintf(out, "Seat %u: Player%u%s", i + 1, i,
+                i == record->dealer ? " (button)" :
+                i == record->small_blind_pos ? " (small blind)" :
+                i == record->big_blind_pos ? " (big blind)" : "");
+        if(folded_on[i] != PHASE_SHOWDOWN) {
+            fprintf(out, " folded %s\n", street_summary_names[folded_on[i]]);
+        } else if(showdown) {
+            hand_text_describe(game.players[i].hand_set | game.community_set, description, sizeof(description));
+            fprintf(out, " showed ");
+            hand_text_cards(out, game.players[i].hand, HAND_SIZE);
+            if(won[i]) {
+                fprintf(out, " and won (%" PRIu32 ") with %s\n", won[i], description);
+            } else {
+                fprintf(out, " and lost with %s\n", description);
+            }
+        } else {
+            fprintf(out, " collected (%" PRIu32 ")\n", won[i]);
+        }
+    }
+    fprintf(out, "\n\n");
+    return true;
+}
+
+// Parsing works on one line in place: `line` is not NUL terminated, `end`
+// points just past its last character
+
+static bool hand_text_starts(const char* line, const char* end, const char* prefix) {
+    size_t length = strlen(prefix);
+    return (size_t)(end - line) >= length && memcmp(line, prefix, length) == 0;
+}
+
+static const char* hand_text_find(const char* line, const char* end, const char* needle) {
+    size_t length = strlen(needle);
+    for(const char* at = line; at + length <= end; at++) {
+        if(memcmp(at, needle, length) == 0) return at;
+    }
+    return NULL;
+}
+
+static uint64_t hand_text_number(const char* at, const char* end) {
+    uint64_t value = 0;
+    while(at < end && (*at < '0' || *at > '9')) at++;
+    while(at < end && *at >= '0' && *at <= '9') {
+        value = value * 10 + (uint64_t)(*at++ - '0');
+    }
+    return value;
+}
+
+// Cards inside the last "[...]" of the line
+static uint8_t hand_text_parse_cards(const char* line, const char* end, Card* cards, uint8_t max) {
+    const char* open = NULL;
+    for(const char* at = line; at < end; at++) {
+        if(*at == '[') open = at + 1;
+    }
+    if(!open) return 0;
+
+    uint8_t count = 0;
+    for(const char* at = open; at + 1 < end && *at != ']' && count < max;) {
+        if(*at == ' ') {
+            at++;
+            continue;
+        }
+        if(!poker_parse_card(at, &cards[count])) return count;
+        at += at[0] == '1' ? 3 : 2;
+        count++;
+    }
+    return count;
+}
+
+static HandTextSeat* hand_text_seat(HandTextHand* hand, const char* name, size_t length) {
+    for(uint8_t i = 0; i < hand->seat_count; i++) {
+        HandTextSeat* seat = &hand->seats[i];
+        if(strlen(seat->name) == length && memcmp(seat->name, name, length) == 0) return seat;
+    }
+    return NULL;
+}
+
+static void hand_text_parse_line(HandTextHand* hand, bool* in_hand, bool* in_summary, const char* line, const char* end) {
+    if(hand_text_starts(line, end, "PokerStars Hand #")) {
+        memset(hand, 0, sizeof(HandTextHand));
+        hand->id = hand_text_number(line + 17, end);
+        const char* blinds = hand_text_find(line, end, "(");
+        if(blinds) {
+            // "($0.50/$1 USD)" or "(10/20)": cents are dropped
+            hand->small_blind = (uint32_t)hand_text_number(blinds, end);
+            const char* slash = hand_text_find(blinds, end, "/");
+            if(slash) hand->big_blind = (uint32_t)hand_text_number(slash, end);
+        }
+        *in_hand = true;
+        *in_summary = false;
+        return;
+    }
+    if(!*in_hand || *in_summary) return;
+
+    if(hand_text_starts(line, end, "Seat ")) {
+        // "Seat 3: name (1500 in chips)"; only before the summary
+        const char* colon = hand_text_find(line, end, ": ");
+        const char* stack = hand_text_find(line, end, " in chips");
+        if(!colon || !stack || hand->seat_count == HAND_TEXT_MAX_SEATS) return;
+        const char* open = stack;
+        while(open > colon && *open != '(') open--;
+        if(open <= colon + 2) return;
+
+        HandTextSeat* seat = &hand->seats[hand->seat_count++];
+        size_t length = (size_t)(open - 1 - (colon + 2));
+        if(length >= HAND_TEXT_NAME_SIZE) length = HAND_TEXT_NAME_SIZE - 1;
+        memcpy(seat->name, colon + 2, length);
+        seat->name[length] = '\0';
+        seat->stack = (uint32_t)hand_text_number(open, end);
+        return;
+    }
+
+    if(hand_text_starts(line, end, "*** ")) {
+        if(hand_text_starts(line, end, "*** FLOP ***") || hand_text_starts(line, end, "*** TURN ***") ||
+           hand_text_starts(line, end, "*** RIVER ***")) {
+            // The last bracket holds the new card(s)
+            hand->board_count +=
+                hand_text_parse_cards(line, end, &hand->board[hand->board_count], COMMUNITY_SIZE - hand->board_count);
+        } else if(hand_text_starts(line, end, "*** SHOW DOWN ***")) {
+            hand->showdown = true;
+        } else if(hand_text_starts(line, end, "*** SUMMARY ***")) {
+            *in_summary = true;
+        }
+        return;
+    }
+
+    if(hand_text_starts(line, end, "Dealt to ")) {
+        const char* open = hand_text_find(line, end, " [");
+        if(!open) return;
+        HandTextSeat* seat = hand_text_seat(hand, line + 9, (size_t)(open - (line + 9)));
+        if(seat && hand_text_parse_cards(line, end, seat->hole, HAND_SIZE) == HAND_SIZE) {
+            seat->hole_known = true;
+        }
+        return;
+    }
+
+    // "Uncalled bet (30) returned to name": given back, not won
+    if(hand_text_starts(line, end, "Uncalled bet (")) {
+        const char* to = hand_text_find(line, end, " returned to ");
+        if(!to) return;
+        HandTextSeat* seat = hand_text_seat(hand, to + 13, (size_t)(end - (to + 13)));
+        if(seat) seat->returned += (uint32_t)hand_text_number(line, end);
+        return;
+    }
+
+    // "name collected 250 from pot" (also "from side pot", "from main pot")
+    const char* collected = hand_text_find(line, end, " collected ");
+    if(collected && hand_text_find(collected, end, " pot")) {
+        HandTextSeat* seat = hand_text_seat(hand, line, (size_t)(collected - line));
+        if(seat) seat->collected += (uint32_t)hand_text_number(collected, end);
+        return;
+    }
+
+    // "name: folds", "name: shows [Ah Kd] (...)"
+    const char* colon = hand_text_find(line, end, ": ");
+    if(!colon) return;
+    HandTextSeat* seat = hand_text_seat(hand, line, (size_t)(colon - line));
+    if(!seat) return;
+    if(hand_text_starts(colon + 2, end, "folds")) {
+        seat->folded = true;
+    } else if(hand_text_starts(colon + 2, end, "shows ")) {
+        if(hand_text_parse_cards(colon, end, seat->hole, HAND_SIZE) == HAND_SIZE) {
+            seat->hole_known = true;
+        }
+    }
+}
+
+// Streams `in` through one fixed buffer: lines are parsed where they lie in
+// the buffer, and only the partial line at the end of a chunk is moved to
+// the front before the next read. A hand is reported when the next one
+// starts or the input ends.
+bool hand_text_import(FILE* in, HandTextCallback callback, void* context, HandTextStats* stats) {
+    char* buffer = malloc(HAND_TEXT_CHUNK);
+    HandTextHand* hand = malloc(sizeof(HandTextHand));
+    if(!buffer || !hand) {
+        free(buffer);
+        free(hand);
+        return false;
+    }
+
+    bool in_hand = false, in_summary = false, skipping = false;
+    size_t kept = 0;
+    memset(stats, 0, sizeof(HandTextStats));
+
+    while(true) {
+        size_t read = fread(buffer + kept, 1, HAND_TEXT_CHUNK - kept, in);
+        size_t filled = kept + read;
+        bool last = read == 0;
+        stats->bytes += read;
+
+        const char* line = buffer;
+        const char* limit = buffer + filled;
+        while(line < limit) {
+            const char* newline = memchr(line, '\n', (size_t)(limit - line));
+            if(!newline && !last) break;
+            const char* end = newline ? newline : limit;
+
+            if(skipping) {
+                skipping = false;
+            } else {
+                const char* stop = end;
+                if(stop > line && stop[-1] == '\r') stop--;
+                // A new hand header reports the previous hand first
+                if(in_hand && hand_text_starts(line, stop, "PokerStars Hand #")) {
+                    callback(hand, context);
+                    stats->hands++;
+                }
+                hand_text_parse_line(hand, &in_hand, &in_summary, line, stop);
+                stats->lines++;
+            }
+            line = newline ? newline + 1 : limit;
+        }
+
+        kept = (size_t)(limit - line);
+        if(kept == HAND_TEXT_CHUNK) {
+            // A line longer than the buffer: drop it up to its newline
+            stats->skipped_lines++;
+            skipping = true;
+            kept = 0;
+        }
+        memmove(buffer, line, kept);
+        if(last) break;
+    }
+
+    if(in_hand) {
+        callback(hand, context);
+        stats->hands++;
+    }
+
+    bool ok = !ferror(in);
+    free(buffer);
+    free(hand);
+    return ok;
+}
\ No newline at end of file
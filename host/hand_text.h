@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdio.h>
+#include "poker.h"
+#include "hand_history.h"
+
+// Text hand histories in the PokerStars layout, the one most analysis tools
+// (trackers, equity and replay tools) read. Export turns binary HandRecords
+// into text; import streams a text file of any size through a fixed buffer
+// and hands each parsed hand to a callback.
+
+// Seats of an imported hand; real tables have up to ten
+#define HAND_TEXT_MAX_SEATS 10
+#define HAND_TEXT_NAME_SIZE 32
+
+typedef struct {
+    char name[HAND_TEXT_NAME_SIZE];
+    uint32_t stack;
+    uint32_t collected; // Chips won from the pot(s)
+    uint32_t returned; // Uncalled bet given back, not part of collected
+    Card hole[HAND_SIZE];
+    bool hole_known; // Dealt to the hero or shown down
+    bool folded;
+} HandTextSeat;
+
+// One imported hand. Reused for every hand of a file, so nothing is
+// allocated while importing.
+typedef struct {
+    uint64_t id;
+    uint32_t small_blind;
+    uint32_t big_blind;
+    uint8_t seat_count;
+    HandTextSeat seats[HAND_TEXT_MAX_SEATS];
+    Card board[COMMUNITY_SIZE];
+    uint8_t board_count;
+    bool showdown; // "*** SHOW DOWN ***" was reached
+} HandTextHand;
+
+typedef void (*HandTextCallback)(const HandTextHand* hand, void* context);
+
+typedef struct {
+    uint64_t bytes;
+    uint64_t lines;
+    uint64_t hands;
+    uint64_t skipped_lines; // Longer than the read buffer
+} HandTextStats;
+
+// Function declarations
+bool hand_text_export(FILE* out, const HandRecord* record);
+bool hand_text_import(FILE* in, HandTextCallback callback, void* context, HandTextStats* stats);
+void hand_text_describe(CardSet cards, char* buffer, size_t buffer_size);
\ No newline at end of file
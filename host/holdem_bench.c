@@ -0,0 +1,293 @@
+// holdem-bench: microbenchmarks of the poker core.
+//
+// Every benchmark runs on inputs generated from a fixed seed, so runs on the
+// same machine are comparable. Each one is calibrated (the iteration count
+// doubles until a run takes at least the minimum time), then repeated; the
+// fastest repetition is reported, as it is the one least disturbed by the
+// rest of the system.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "poker.h"
+#include "engine.h"
+#include "ai.h"
+#include "platform.h"
+
+#define BENCH_INPUTS 4096 // Power of two, inputs are cycled through
+#define BENCH_REPEATS 3
+
+typedef struct {
+    Card cards[BENCH_INPUTS][HAND_SIZE + COMMUNITY_SIZE]; // Hole cards, then the board
+    GameState positions[BENCH_INPUTS]; // Decisions taken from simulated hands
+    uint8_t position_seats[BENCH_INPUTS];
+    AIPlayer ai_players[MAX_PLAYERS];
+    GameState game; // Running table of the full-hand benchmark
+    Deck deck;
+    Rng rng;
+    uint64_t seed;
+} BenchContext;
+
+// Runs `iterations` operations and returns how many were done
+typedef uint64_t (*BenchFunction)(BenchContext* bench, uint64_t iterations);
+
+typedef struct {
+    const char* name;
+    BenchFunction run;
+} Benchmark;
+
+typedef struct {
+    uint64_t ops;
+    double seconds;
+} BenchResult;
+
+// Results feed this so the compiler cannot drop the work
+static volatile uint32_t bench_sink;
+
+static uint64_t bench_evaluate(BenchContext* bench, uint64_t iterations, uint8_t community_count) {
+    uint32_t sum = 0;
+    for(uint64_t i = 0; i < iterations; i++) {
+        Card* cards = bench->cards[i & (BENCH_INPUTS - 1)];
+        sum += poker_evaluate_hand(cards, cards + HAND_SIZE, community_count).strength;
+    }
+    bench_sink = sum;
+    return iterations;
+}
+
+static uint64_t bench_evaluate_5(BenchContext* bench, uint64_t iterations) {
+    return bench_evaluate(bench, iterations, 3);
+}
+
+static uint64_t bench_evaluate_6(BenchContext* bench, uint64_t iterations) {
+    return bench_evaluate(bench, iterations, 4);
+}
+
+static uint64_t bench_evaluate_7(BenchContext* bench, uint64_t iterations) {
+    return bench_evaluate(bench, iterations, 5);
+}
+
+static uint64_t bench_shuffle(BenchContext* bench, uint64_t iterations) {
+    for(uint64_t i = 0; i < iterations; i++) {
+        // Reshuffle the whole (still valid) permutation
+        bench->deck.top = 0;
+        poker_shuffle_deck(&bench->deck, &bench->rng);
+    }
+    bench_sink = bench->deck.cards[0];
+    return iterations;
+}
+
+// One op is one card; the deck is reset every 52 cards
+static uint64_t bench_deal(BenchContext* bench, uint64_t iterations) {
+    uint32_t sum = 0;
+    uint64_t rounds = (iterations + DECK_SIZE - 1) / DECK_SIZE;
+    for(uint64_t i = 0; i < rounds; i++) {
+        bench->deck.top = 0;
+        bench->deck.dealt = 0;
+        poker_shuffle_deck_lazy(&bench->deck, &bench->rng);
+        for(uint8_t j = 0; j < DECK_SIZE; j++) {
+            sum += poker_deal_card(&bench->deck);
+        }
+        bench->rng = bench->deck.rng;
+    }
+    bench_sink = sum;
+    return rounds * DECK_SIZE;
+}
+
+static uint64_t bench_ai_strength(BenchContext* bench, uint64_t iterations) {
+    float sum = 0;
+    for(uint64_t i = 0; i < iterations; i++) {
+        Card* cards = bench->cards[i & (BENCH_INPUTS - 1)];
+        sum += ai_evaluate_hand_strength(cards, cards + HAND_SIZE, 5);
+    }
+    bench_sink = (uint32_t)sum;
+    return iterations;
+}
+
+// Decisions on recorded positions with a cold strength cache, i.e. the
+// first decision of a street
+static uint64_t bench_ai_decide(BenchContext* bench, uint64_t iterations) {
+    uint32_t sum = 0;
+    for(uint64_t i = 0; i < iterations; i++) {
+        uint32_t index = i & (BENCH_INPUTS - 1);
+        uint8_t seat = bench->position_seats[index];
+        AIPlayer* ai = &bench->ai_players[seat];
+        ai->strength_cache.valid = false;
+        sum += ai_decide_action(&bench->positions[index], seat, ai);
+    }
+    bench_sink = sum;
+    return iterations;
+}
+
+static void bench_new_match(BenchContext* bench) {
+    engine_init(&bench->game, bench->seed);
+    ai_init_players(&bench->ai_players[1]);
+    bench->ai_players[0] = bench->ai_players[MAX_PLAYERS - 1];
+}
+
+// Deal, four AIs acting to showdown, payout: what holdem-sim does per hand
+static uint64_t bench_full_hand(BenchContext* bench, uint64_t iterations) {
+    GameState* game = &bench->game;
+    for(uint64_t i = 0; i < iterations; i++) {
+        if(engine_players_with_chips(game) < 2) {
+            uint32_t hand_number = game->hand_number;
+            bench_new_match(bench);
+            game->hand_number = hand_number;
+        }
+        engine_new_hand(game);
+        while(game->phase != PHASE_SHOWDOWN) {
+            uint8_t seat = game->current_player;
+            Action action = engine_apply_action(game, ai_decide(game, seat, &bench->ai_players[seat]));
+            for(uint8_t j = 0; j < MAX_PLAYERS; j++) {
+                ai_update_opponent_model(&bench->ai_players[j], seat, action.type);
+            }
+        }
+        ShowdownResult result;
+        engine_showdown(game, &result);
+    }
+    bench_sink = game->hand_number;
+    return iterations;
+}
+
+static const Benchmark benchmarks[] = {
+    {"poker_evaluate_hand_5", bench_evaluate_5},
+    {"poker_evaluate_hand_6", bench_evaluate_6},
+    {"poker_evaluate_hand_7", bench_evaluate_7},
+    {"poker_shuffle_deck", bench_shuffle},
+    {"poker_deal_card", bench_deal},
+    {"ai_evaluate_hand_strength", bench_ai_strength},
+    {"ai_decide_action", bench_ai_decide},
+    {"full_hand", bench_full_hand},
+};
+
+static void bench_setup(BenchContext* bench, uint64_t seed) {
+    memset(bench, 0, sizeof(BenchContext));
+    bench->seed = seed;
+    rng_seed(&bench->rng, seed, 0);
+    poker_eval_init();
+
+    // Random 7-card draws
+    Deck deck;
+    for(uint32_t i = 0; i < BENCH_INPUTS; i++) {
+        poker_init_deck(&deck);
+        poker_shuffle_deck_lazy(&deck, &bench->rng);
+        for(uint8_t j = 0; j < HAND_SIZE + COMMUNITY_SIZE; j++) {
+            bench->cards[i][j] = poker_deal_card(&deck);
+        }
+        bench->rng = deck.rng;
+    }
+    poker_init_deck(&bench->deck);
+
+    // Positions: every decision point of simulated hands, in order
+    bench_new_match(bench);
+    uint32_t count = 0;
+    while(count < BENCH_INPUTS) {
+        if(engine_players_with_chips(&bench->game) < 2) bench_new_match(bench);
+        engine_new_hand(&bench->game);
+        while(bench->game.phase != PHASE_SHOWDOWN) {
+            uint8_t seat = bench->game.current_player;
+            if(count < BENCH_INPUTS) {
+                bench->positions[count] = bench->game;
+                bench->position_seats[count++] = seat;
+            }
+            engine_apply_action(&bench->game, ai_decide(&bench->game, seat, &bench->ai_players[seat]));
+        }
+        ShowdownResult result;
+        engine_showdown(&bench->game, &result);
+    }
+
+    // The full-hand benchmark starts from a fresh table
+    bench_new_match(bench);
+}
+
+static BenchResult bench_run(BenchContext* bench, const Benchmark* benchmark, double min_seconds) {
+    BenchResult best = {0, 0};
+    uint64_t iterations = 64;
+
+    // Calibrate: double until one run is long enough to time
+    while(true) {
+        uint64_t start = platform_time_us();
+        uint64_t ops = benchmark->run(bench, iterations);
+        double seconds = (platform_time_us() - start) * 1e-6;
+        if(seconds >= min_seconds || iterations >= (1ULL << 40)) {
+            best = (BenchResult){ops, seconds};
+            break;
+        }
+        iterations *= 2;
+    }
+
+    for(uint8_t i = 1; i < BENCH_REPEATS; i++) {
+        uint64_t start = platform_time_us();
+        uint64_t ops = benchmark->run(bench, iterations);
+        double seconds = (platform_time_us() - start) * 1e-6;
+        if(seconds * best.ops < best.seconds * ops) {
+            best = (BenchResult){ops, seconds};
+        }
+    }
+    return best;
+}
+
+static void bench_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-s seed] [-t ms] [-f name] [-J]\n"
+            "  -s seed   input seed (default 1)\n"
+            "  -t ms     minimum time of one timed run (default 200)\n"
+            "  -f name   only run benchmarks whose name contains this\n"
+            "  -J        print JSON instead of a table\n",
+            argv0);
+}
+
+int main(int argc, char** argv) {
+    uint64_t seed = 1;
+    double min_seconds = 0.2;
+    const char* filter = NULL;
+    bool json = false;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-s") && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+            min_seconds = strtoul(argv[++i], NULL, 10) * 1e-3;
+        } else if(!strcmp(argv[i], "-f") && i + 1 < argc) {
+            filter = argv[++i];
+        } else if(!strcmp(argv[i], "-J")) {
+            json = true;
+        } else {
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    BenchContext* bench = malloc(sizeof(BenchContext));
+    bench_setup(bench, seed);
+
+    if(json) {
+        printf("{\"seed\": %" PRIu64 ", \"min_time_ms\": %.0f, \"benchmarks\": [", seed, min_seconds * 1e3);
+    } else {
+        printf("%-26s  %12s  %14s\n", "benchmark", "ns/op", "ops/sec");
+    }
+
+    bool first = true;
+    for(size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        if(filter && !strstr(benchmarks[i].name, filter)) continue;
+
+        BenchResult result = bench_run(bench, &benchmarks[i], min_seconds);
+        double ns_per_op = result.ops ? result.seconds * 1e9 / result.ops : 0.0;
+        double ops_per_sec = result.seconds > 0 ? result.ops / result.seconds : 0.0;
+
+        if(json) {
+            printf("%s\n  {\"name\": \"%s\", \"ops\": %" PRIu64 ", \"seconds\": %.6f, "
+                   "\"ns_per_op\": %.3f, \"ops_per_sec\": %.1f}",
+                   first ? "" : ",", benchmarks[i].name, result.ops, result.seconds, ns_per_op, ops_per_sec);
+        } else {
+            printf("%-26s  %12.2f  %14.0f\n", benchmarks[i].name, ns_per_op, ops_per_sec);
+        }
+        fflush(stdout);
+        first = false;
+    }
+    if(json) printf("\n]}\n");
+
+    free(bench);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,642 @@
+// holdem-buckets: writes the card abstraction tables of buckets.h, one file
+// per street (preflop.bkt, flop.bkt, turn.bkt, river.bkt).
+//
+// Everything is exact, no sampling. The kernel is the river: for one
+// five-card board it evaluates the 1081 hole pairs left, sorts them by
+// strength and sweeps the order once. Counting the weaker and equal pairs
+// that share a card with each hand gives the hand strength (HS) of every
+// pair against one random hand. Earlier streets run the kernel for every
+// runout of the board and average HS and HS^2 into EHS and EHS^2. Preflop
+// averages over all boards (the canonical river boards, weighted) by
+// starting-hand class.
+//
+// Entries are then clustered with k-means in the (EHS, EHS^2) plane. Entries
+// first go into a 256x256 histogram of that plane, weighted by the number
+// of boards each canonical board stands for. The clustering runs on the
+// histogram cells, so it costs the same on every street.
+//
+// Boards are split among worker threads; each has its own histogram, and
+// entries are written to disjoint slices of one array.
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "poker.h"
+#include "buckets.h"
+#include "preflop.h"
+#include "platform.h"
+#include "rng.h"
+
+#define GEN_MAX_THREADS 256
+#define GEN_GRID 256 // Histogram cells per axis
+#define GEN_CELLS (GEN_GRID * GEN_GRID)
+#define GEN_KMEANS_ROUNDS 100
+#define GEN_RIVER_PAIRS 1081 // C(47, 2)
+#define GEN_OPPONENT_PAIRS 990 // C(45, 2): hands left once the hero's are out
+#define GEN_LOOKUPS 1000000
+
+static const uint8_t gen_street_cards[] = {0, 3, 4, 5};
+
+typedef struct {
+    double weight;
+    double ehs;
+    double ehs2;
+} GenCell;
+
+typedef struct {
+    uint8_t board_cards;
+    uint32_t board_count;
+    uint64_t* boards; // Canonical boards, ascending
+    uint32_t* weights; // Boards each canonical board stands for
+    uint32_t holes;
+    uint16_t* cells; // Histogram cell of every entry
+    // Preflop runs over the river boards
+    uint32_t river_count;
+    const uint64_t* river_boards;
+    const uint32_t* river_weights;
+    _Atomic uint32_t next;
+} GenStreet;
+
+// River kernel output, indexed by pair
+typedef struct {
+    Card low[GEN_RIVER_PAIRS];
+    Card high[GEN_RIVER_PAIRS];
+    uint16_t strength[GEN_RIVER_PAIRS];
+    uint16_t order[GEN_RIVER_PAIRS];
+    uint16_t scratch[GEN_RIVER_PAIRS];
+    float hs[GEN_RIVER_PAIRS];
+} GenRiver;
+
+typedef struct {
+    GenStreet* street;
+    GenCell* histogram;
+    GenCell classes[PREFLOP_CLASSES];
+    GenRiver river;
+    double hs[DECK_SIZE * (DECK_SIZE - 1) / 2];
+    double hs2[DECK_SIZE * (DECK_SIZE - 1) / 2];
+} GenWorker;
+
+static double gen_now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int gen_compare_boards(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+// Canonical boards of a street with the number of boards behind each
+static void gen_boards(GenStreet* street) {
+    uint8_t k = street->board_cards;
+    if(k == 0) {
+        street->board_count = 1;
+        street->boards = calloc(1, sizeof(uint64_t));
+        street->weights = malloc(sizeof(uint32_t));
+        street->weights[0] = 1;
+        return;
+    }
+
+    // Every k-card set in increasing order (Gosper's hack), canonicalized
+    uint32_t total = 1;
+    for(uint8_t i = 0; i < k; i++) {
+        total = total * (DECK_SIZE - i) / (i + 1);
+    }
+    uint64_t* all = malloc(total * sizeof(uint64_t));
+    uint64_t set = (1ULL << k) - 1;
+    for(uint32_t i = 0; i < total; i++) {
+        all[i] = buckets_canonical(set, NULL);
+        uint64_t carry = set | (set - 1);
+        set = (carry + 1) | (((~carry & -~carry) - 1) >> (__builtin_ctzll(set) + 1));
+    }
+    qsort(all, total, sizeof(uint64_t), gen_compare_boards);
+
+    street->boards = malloc(total * sizeof(uint64_t));
+    street->weights = malloc(total * sizeof(uint32_t));
+    street->board_count = 0;
+    for(uint32_t i = 0; i < total; i++) {
+        if(street->board_count && street->boards[street->board_count - 1] == all[i]) {
+            street->weights[street->board_count - 1]++;
+        } else {
+            street->boards[street->board_count] = all[i];
+            street->weights[street->board_count++] = 1;
+        }
+    }
+    free(all);
+}
+
+// HS of every pair left on a five-card board against one random hand.
+// Pairs are numbered in colex order of the cards left.
+static void gen_river(GenRiver* river, CardSet board) {
+    Card left[DECK_SIZE];
+    uint8_t count = 0;
+    for(CardSet rest = ~board & CARD_SET_FULL; rest; rest &= rest - 1) {
+        left[count++] = (Card)__builtin_ctzll(rest);
+    }
+
+    uint16_t pair = 0;
+    for(uint8_t j = 1; j < count; j++) {
+        for(uint8_t i = 0; i < j; i++) {
+            river->low[pair] = left[i];
+            river->high[pair] = left[j];
+            river->strength[pair] =
+                poker_hand_rank_u16(board | poker_card_bit(left[i]) | poker_card_bit(left[j]));
+            pair++;
+        }
+    }
+
+    // Radix sort by strength (13 bits): low 7 bits, then the rest
+    uint16_t counts[128];
+    memset(counts, 0, sizeof(counts));
+    for(uint16_t p = 0; p < pair; p++) {
+        counts[river->strength[p] & 127]++;
+    }
+    for(uint16_t b = 0, sum = 0; b < 128; b++) {
+        uint16_t n = counts[b];
+        counts[b] = sum;
+        sum += n;
+    }
+    for(uint16_t p = 0; p < pair; p++) {
+        river->scratch[counts[river->strength[p] & 127]++] = p;
+    }
+    memset(counts, 0, sizeof(counts));
+    for(uint16_t p = 0; p < pair; p++) {
+        counts[river->strength[p] >> 7]++;
+    }
+    for(uint16_t b = 0, sum = 0; b < 128; b++) {
+        uint16_t n = counts[b];
+        counts[b] = sum;
+        sum += n;
+    }
+    for(uint16_t i = 0; i < pair; i++) {
+        uint16_t p = river->scratch[i];
+        river->order[counts[river->strength[p] >> 7]++] = p;
+    }
+
+    // Sweep groups of equal strength from the weakest. A pair beats every
+    // weaker pair except those holding one of its cards (no other pair
+    // holds both), and ties the equal ones the same way.
+    uint16_t below = 0;
+    uint16_t below_with[DECK_SIZE] = {0};
+    uint16_t equal_with[DECK_SIZE] = {0};
+    for(uint16_t start = 0; start < pair;) {
+        uint16_t end = start;
+        uint16_t strength = river->strength[river->order[start]];
+        while(end < pair && river->strength[river->order[end]] == strength) {
+            uint16_t p = river->order[end++];
+            equal_with[river->low[p]]++;
+            equal_with[river->high[p]]++;
+        }
+        uint16_t equal = end - start;
+        for(uint16_t i = start; i < end; i++) {
+            uint16_t p = river->order[i];
+            uint16_t wins = below - below_with[river->low[p]] - below_with[river->high[p]];
+            uint16_t ties = equal - equal_with[river->low[p]] - equal_with[river->high[p]] + 1;
+            river->hs[p] = (wins + ties * 0.5f) / GEN_OPPONENT_PAIRS;
+        }
+        for(uint16_t i = start; i < end; i++) {
+            uint16_t p = river->order[i];
+            below_with[river->low[p]]++;
+            below_with[river->high[p]]++;
+            equal_with[river->low[p]] = 0;
+            equal_with[river->high[p]] = 0;
+        }
+        below += equal;
+        start = end;
+    }
+}
+
+static uint16_t gen_cell(double ehs, double ehs2) {
+    uint32_t x = (uint32_t)(ehs * GEN_GRID);
+    uint32_t y = (uint32_t)(ehs2 * GEN_GRID);
+    if(x >= GEN_GRID) x = GEN_GRID - 1;
+    if(y >= GEN_GRID) y = GEN_GRID - 1;
+    return (uint16_t)(x * GEN_GRID + y);
+}
+
+static void gen_record(GenWorker* worker, uint64_t entry, double ehs, double ehs2, double weight) {
+    uint16_t cell = gen_cell(ehs, ehs2);
+    worker->street->cells[entry] = cell;
+    worker->histogram[cell].weight += weight;
+    worker->histogram[cell].ehs += weight * ehs;
+    worker->histogram[cell].ehs2 += weight * ehs2;
+}
+
+// EHS and EHS^2 of every hole pair on one canonical board: the kernel runs
+// on each completion of the board to five cards
+static void gen_board(GenWorker* worker, uint32_t index) {
+    GenStreet* street = worker->street;
+    CardSet board = street->boards[index];
+    uint8_t missing = COMMUNITY_SIZE - street->board_cards;
+
+    // Position of each card among the cards left, for the colex hole index
+    uint8_t left_index[DECK_SIZE];
+    Card left[DECK_SIZE];
+    uint8_t count = 0;
+    for(Card card = 0; card < DECK_SIZE; card++) {
+        left_index[card] = count;
+        if(!(board & poker_card_bit(card))) left[count++] = card;
+    }
+
+    memset(worker->hs, 0, street->holes * sizeof(double));
+    memset(worker->hs2, 0, street->holes * sizeof(double));
+    uint32_t runouts = 0;
+    for(uint8_t a = 0; a < (missing ? count : 1); a++) {
+        for(uint8_t b = missing == 2 ? a + 1 : 0; b < (missing == 2 ? count : 1); b++) {
+            CardSet runout = 0;
+            if(missing >= 1) runout |= poker_card_bit(left[a]);
+            if(missing == 2) runout |= poker_card_bit(left[b]);
+            gen_river(&worker->river, board | runout);
+            for(uint16_t p = 0; p < GEN_RIVER_PAIRS; p++) {
+                uint8_t low = left_index[worker->river.low[p]];
+                uint8_t high = left_index[worker->river.high[p]];
+                uint32_t hole = (uint32_t)high * (high - 1) / 2 + low;
+                double hs = worker->river.hs[p];
+                worker->hs[hole] += hs;
+                worker->hs2[hole] += hs * hs;
+            }
+            runouts++;
+        }
+    }
+
+    // Every hole pair sees the same number of runouts
+    uint32_t per_hole = runouts * GEN_RIVER_PAIRS / street->holes;
+    uint64_t first = (uint64_t)index * street->holes;
+    for(uint32_t hole = 0; hole < street->holes; hole++) {
+        gen_record(worker, first + hole, worker->hs[hole] / per_hole, worker->hs2[hole] / per_hole,
+                   street->weights[index]);
+    }
+}
+
+// Preflop: every river board, weighted, summed by starting-hand class
+static void gen_preflop_board(GenWorker* worker, uint32_t index) {
+    GenStreet* street = worker->street;
+    CardSet board = street->river_boards[index];
+    double weight = street->river_weights[index];
+    gen_river(&worker->river, board);
+    for(uint16_t p = 0; p < GEN_RIVER_PAIRS; p++) {
+        CardSet hole = poker_card_bit(worker->river.low[p]) | poker_card_bit(worker->river.high[p]);
+        GenCell* cell = &worker->classes[preflop_class(hole)];
+        double hs = worker->river.hs[p];
+        cell->weight += weight;
+        cell->ehs += weight * hs;
+        cell->ehs2 += weight * hs * hs;
+    }
+}
+
+static void* gen_thread(void* ctx) {
+    GenWorker* worker = (GenWorker*)ctx;
+    GenStreet* street = worker->street;
+    bool preflop = street->board_cards == 0;
+    uint32_t count = preflop ? street->river_count : street->board_count;
+
+    while(true) {
+        uint32_t index = atomic_fetch_add_explicit(&street->next, 1, memory_order_relaxed);
+        if(index >= count) break;
+        if(preflop) {
+            gen_preflop_board(worker, index);
+        } else {
+            gen_board(worker, index);
+        }
+    }
+    return NULL;
+}
+
+// Weighted k-means of the histogram cells; buckets come out by ascending
+// EHS. Starts from the EHS quantiles, so it is deterministic.
+static void gen_cluster(const GenCell* histogram, uint8_t buckets, float centroids[][2], uint8_t* cell_bucket) {
+    uint32_t* used = malloc(GEN_CELLS * sizeof(uint32_t));
+    uint32_t used_count = 0;
+    double total = 0;
+    for(uint32_t c = 0; c < GEN_CELLS; c++) {
+        if(histogram[c].weight <= 0) continue;
+        used[used_count++] = c;
+        total += histogram[c].weight;
+    }
+
+    // Cells are numbered EHS-major, so this walks them by ascending EHS
+    double centers[BUCKETS_MAX][2];
+    double seen = 0;
+    uint8_t next = 0;
+    for(uint32_t i = 0; i < used_count && next < buckets; i++) {
+        const GenCell* cell = &histogram[used[i]];
+        seen += cell->weight;
+        while(next < buckets && seen >= total * (next + 0.5) / buckets) {
+            centers[next][0] = cell->ehs / cell->weight;
+            centers[next][1] = cell->ehs2 / cell->weight;
+            next++;
+        }
+    }
+
+    memset(cell_bucket, 0, GEN_CELLS);
+    for(uint32_t round = 0; round < GEN_KMEANS_ROUNDS; round++) {
+        bool changed = round == 0;
+        for(uint32_t i = 0; i < used_count; i++) {
+            const GenCell* cell = &histogram[used[i]];
+            double x = cell->ehs / cell->weight;
+            double y = cell->ehs2 / cell->weight;
+            uint8_t best = 0;
+            double best_distance = 1e30;
+            for(uint8_t b = 0; b < buckets; b++) {
+                double dx = x - centers[b][0];
+                double dy = y - centers[b][1];
+                double distance = dx * dx + dy * dy;
+                if(distance < best_distance) {
+                    best_distance = distance;
+                    best = b;
+                }
+            }
+            if(cell_bucket[used[i]] != best) changed = true;
+            cell_bucket[used[i]] = best;
+        }
+        if(!changed) break;
+
+        GenCell sums[BUCKETS_MAX] = {0};
+        for(uint32_t i = 0; i < used_count; i++) {
+            const GenCell* cell = &histogram[used[i]];
+            GenCell* sum = &sums[cell_bucket[used[i]]];
+            sum->weight += cell->weight;
+            sum->ehs += cell->ehs;
+            sum->ehs2 += cell->ehs2;
+        }
+        for(uint8_t b = 0; b < buckets; b++) {
+            if(sums[b].weight <= 0) continue; // Empty cluster keeps its center
+            centers[b][0] = sums[b].ehs / sums[b].weight;
+            centers[b][1] = sums[b].ehs2 / sums[b].weight;
+        }
+    }
+
+    // Renumber by ascending EHS
+    uint8_t rank[BUCKETS_MAX];
+    uint8_t order[BUCKETS_MAX];
+    for(uint8_t b = 0; b < buckets; b++) {
+        uint8_t j = b;
+        while(j > 0 && centers[order[j - 1]][0] > centers[b][0]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = b;
+    }
+    for(uint8_t b = 0; b < buckets; b++) {
+        rank[order[b]] = b;
+        centroids[b][0] = (float)centers[order[b]][0];
+        centroids[b][1] = (float)centers[order[b]][1];
+    }
+    for(uint32_t i = 0; i < used_count; i++) {
+        cell_bucket[used[i]] = rank[cell_bucket[used[i]]];
+    }
+    free(used);
+}
+
+static bool gen_write(const char* path, const BucketHeader* header, const GenStreet* street, const uint8_t* packed) {
+    FILE* out = fopen(path, "wb");
+    if(!out) return false;
+    bool written = fwrite(header, sizeof(BucketHeader), 1, out) == 1 &&
+                   fwrite(street->boards, sizeof(uint64_t), street->board_count, out) == street->board_count &&
+                   fwrite(packed, 1, buckets_packed_size(header), out) == buckets_packed_size(header);
+    return fclose(out) == 0 && written;
+}
+
+// Lookup speed on random hands; on the river every lookup is also checked
+// against the kernel run on the (non-canonical) board itself
+static bool gen_check(const char* path, uint8_t board_cards, const uint8_t* cell_bucket, uint64_t seed) {
+    BucketTable table;
+    if(!buckets_map_open(&table, path)) {
+        fprintf(stderr, "%s: cannot map the table\n", path);
+        return false;
+    }
+
+    CardSet* holes = malloc(GEN_LOOKUPS * sizeof(CardSet));
+    CardSet* boards = malloc(GEN_LOOKUPS * sizeof(CardSet));
+    Rng rng;
+    rng_seed(&rng, seed, board_cards);
+    for(uint32_t i = 0; i < GEN_LOOKUPS; i++) {
+        CardSet dealt = 0;
+        while(poker_set_count(dealt) < HAND_SIZE + board_cards) {
+            dealt |= poker_card_bit((Card)rng_bounded(&rng, DECK_SIZE));
+        }
+        CardSet hole = 0;
+        while(poker_set_count(hole) < HAND_SIZE) {
+            hole |= poker_card_bit((Card)rng_bounded(&rng, DECK_SIZE)) & dealt;
+        }
+        holes[i] = hole;
+        boards[i] = dealt & ~hole;
+    }
+
+    // The first pass also faults the pages in; the second is the one reported
+    uint32_t sum = 0;
+    uint32_t failed = 0;
+    double seconds = 0;
+    for(uint8_t pass = 0; pass < 2; pass++) {
+        sum = 0;
+        failed = 0;
+        uint64_t start = platform_time_us();
+        for(uint32_t i = 0; i < GEN_LOOKUPS; i++) {
+            uint8_t bucket = buckets_lookup(&table, holes[i], boards[i]);
+            if(bucket == BUCKETS_NONE) failed++;
+            sum += bucket;
+        }
+        seconds = (platform_time_us() - start) * 1e-6;
+    }
+    printf("  lookup:      %.1f ns (checksum %" PRIu32 ")\n", seconds * 1e9 / GEN_LOOKUPS, sum);
+
+    if(board_cards == COMMUNITY_SIZE) {
+        GenRiver* river = malloc(sizeof(GenRiver));
+        uint32_t checks = 10000;
+        for(uint32_t i = 0; i < checks; i++) {
+            gen_river(river, boards[i]);
+            uint32_t pair = buckets_hole_index(holes[i], boards[i]);
+            double hs = river->hs[pair];
+            if(buckets_lookup(&table, holes[i], boards[i]) != cell_bucket[gen_cell(hs, hs * hs)]) failed++;
+        }
+        printf("  checked:     %u river lookups against direct evaluation\n", checks);
+        free(river);
+    }
+
+    free(holes);
+    free(boards);
+    buckets_map_close(&table);
+    if(failed) fprintf(stderr, "%s: %u lookups failed\n", path, failed);
+    return failed == 0;
+}
+
+static void gen_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-N buckets] [-S streets] [-j threads] [-o dir]\n"
+            "  -N n       buckets per street, 1-%u (default 8)\n"
+            "  -S list    streets to build, any of p f t r (default pftr)\n"
+            "  -j n       worker threads (default one per core)\n"
+            "  -o dir     output directory (default .)\n",
+            argv0,
+            BUCKETS_MAX);
+}
+
+int main(int argc, char** argv) {
+    uint32_t buckets = 8;
+    const char* streets = "pftr";
+    uint32_t threads = 0;
+    const char* output_dir = ".";
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-N") && i + 1 < argc) {
+            buckets = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-S") && i + 1 < argc) {
+            streets = argv[++i];
+        } else if(!strcmp(argv[i], "-j") && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+            output_dir = argv[++i];
+        } else {
+            gen_usage(argv[0]);
+            return 1;
+        }
+    }
+    if(buckets < 1 || buckets > BUCKETS_MAX) {
+        gen_usage(argv[0]);
+        return 1;
+    }
+
+    if(threads == 0) threads = platform_cpu_count();
+    if(threads > GEN_MAX_THREADS) threads = GEN_MAX_THREADS;
+
+    poker_eval_init();
+    GenStreet river_boards = {.board_cards = COMMUNITY_SIZE};
+    GenWorker* workers = calloc(threads, sizeof(GenWorker));
+    pthread_t* handles = calloc(threads, sizeof(pthread_t));
+    for(uint32_t i = 0; i < threads; i++) {
+        workers[i].histogram = malloc(GEN_CELLS * sizeof(GenCell));
+    }
+    uint8_t* cell_bucket = malloc(GEN_CELLS);
+
+    for(uint8_t s = 0; s < BUCKETS_STREETS; s++) {
+        if(!strchr(streets, buckets_street_names[s][0])) continue;
+        double start = gen_now_seconds();
+
+        GenStreet street = {.board_cards = gen_street_cards[s]};
+        gen_boards(&street);
+        if(s == 0) {
+            // Preflop needs the river boards and their weights
+            if(!river_boards.boards) gen_boards(&river_boards);
+            street.river_count = river_boards.board_count;
+            street.river_boards = river_boards.boards;
+            street.river_weights = river_boards.weights;
+        }
+
+        BucketHeader header;
+        buckets_header_init(&header, street.board_cards, (uint8_t)buckets);
+        header.board_count = street.board_count;
+        street.holes = header.holes;
+        uint64_t entries = (uint64_t)street.board_count * street.holes;
+        street.cells = malloc(entries * sizeof(uint16_t));
+        atomic_init(&street.next, 0);
+
+        for(uint32_t i = 0; i < threads; i++) {
+            workers[i].street = &street;
+            memset(workers[i].histogram, 0, GEN_CELLS * sizeof(GenCell));
+            memset(workers[i].classes, 0, sizeof(workers[i].classes));
+            pthread_create(&handles[i], NULL, gen_thread, &workers[i]);
+        }
+        for(uint32_t i = 0; i < threads; i++) {
+            pthread_join(handles[i], NULL);
+        }
+
+        GenCell* histogram = workers[0].histogram;
+        if(s == 0) {
+            // The class averages become the 1326 preflop entries
+            GenCell classes[PREFLOP_CLASSES] = {0};
+            for(uint32_t i = 0; i < threads; i++) {
+                for(uint8_t c = 0; c < PREFLOP_CLASSES; c++) {
+                    classes[c].weight += workers[i].classes[c].weight;
+                    classes[c].ehs += workers[i].classes[c].ehs;
+                    classes[c].ehs2 += workers[i].classes[c].ehs2;
+                }
+            }
+            workers[0].street = &street;
+            for(Card high = 1; high < DECK_SIZE; high++) {
+                for(Card low = 0; low < high; low++) {
+                    CardSet hole = poker_card_bit(low) | poker_card_bit(high);
+                    GenCell* hand_class = &classes[preflop_class(hole)];
+                    gen_record(&workers[0], buckets_hole_index(hole, 0), hand_class->ehs / hand_class->weight,
+                               hand_class->ehs2 / hand_class->weight, 1.0);
+                }
+            }
+        } else {
+            for(uint32_t i = 1; i < threads; i++) {
+                for(uint32_t c = 0; c < GEN_CELLS; c++) {
+                    histogram[c].weight += workers[i].histogram[c].weight;
+                    histogram[c].ehs += workers[i].histogram[c].ehs;
+                    histogram[c].ehs2 += workers[i].histogram[c].ehs2;
+                }
+            }
+        }
+        double computed = gen_now_seconds();
+
+        gen_cluster(histogram, (uint8_t)buckets, header.centroids, cell_bucket);
+        uint8_t* packed = calloc(buckets_packed_size(&header), 1);
+        double shares[BUCKETS_MAX] = {0};
+        double total = 0;
+        for(uint64_t e = 0; e < entries; e++) {
+            uint8_t bucket = cell_bucket[street.cells[e]];
+            uint64_t bit = e * header.bits;
+            packed[bit / 8] |= (uint8_t)(bucket << (bit % 8));
+            packed[bit / 8 + 1] |= (uint8_t)(bucket >> (8 - bit % 8));
+        }
+        for(uint32_t c = 0; c < GEN_CELLS; c++) {
+            shares[cell_bucket[c]] += histogram[c].weight;
+            total += histogram[c].weight;
+        }
+
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s.bkt", output_dir, buckets_street_names[s]);
+        if(!gen_write(path, &header, &street, packed)) {
+            perror(path);
+            return 1;
+        }
+        double elapsed = gen_now_seconds() - start;
+
+        uint64_t bytes = sizeof(BucketHeader) + street.board_count * sizeof(uint64_t) + buckets_packed_size(&header);
+        printf("%s: %s\n", buckets_street_names[s], path);
+        printf("  boards:      %" PRIu32 " canonical\n", street.board_count);
+        // Kernel evaluations: every pair on every river board visited
+        double evaluations = GEN_RIVER_PAIRS * (double)street.river_count;
+        if(s > 0) {
+            uint8_t left = DECK_SIZE - street.board_cards;
+            uint8_t missing = COMMUNITY_SIZE - street.board_cards;
+            uint32_t runouts = missing == 2 ? left * (left - 1) / 2 : missing == 1 ? left : 1;
+            evaluations = GEN_RIVER_PAIRS * (double)street.board_count * runouts;
+        }
+        printf("  entries:     %" PRIu64 "\n", entries);
+        printf("  evaluations: %.0f (%.0f/sec)\n", evaluations,
+               computed > start ? evaluations / (computed - start) : 0.0);
+        printf("  seconds:     %.3f\n", elapsed);
+        printf("  table size:  %" PRIu64 " bytes (%u bits per entry)\n", bytes, header.bits);
+        for(uint8_t b = 0; b < buckets; b++) {
+            printf("  bucket %-2u    EHS %.3f  EHS^2 %.3f  %5.1f%%\n", b, header.centroids[b][0],
+                   header.centroids[b][1], total > 0 ? shares[b] * 100.0 / total : 0.0);
+        }
+        bool checked = gen_check(path, street.board_cards, cell_bucket, 1);
+
+        free(packed);
+        free(street.cells);
+        free(street.boards);
+        free(street.weights);
+        if(!checked) return 1;
+    }
+
+    for(uint32_t i = 0; i < threads; i++) {
+        free(workers[i].histogram);
+    }
+    free(river_boards.boards);
+    free(river_boards.weights);
+    free(cell_bucket);
+    free(handles);
+    free(workers);
+    return 0;
+}
\ No newline at end of file
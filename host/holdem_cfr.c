@@ -0,0 +1,478 @@
+// holdem-cfr: trains the AI_STRATEGY table with Monte Carlo counterfactual
+// regret minimization (external sampling) over the abstraction in
+// strategy.h, and writes it out as strategy_table.c.
+//
+// The game is one hand of the real engine: four players with
+// STARTING_CHIPS, the app's blinds and a random dealer. Each iteration
+// deals a hand, then traverses it once for every seat: the traversing
+// seat tries each of its legal actions, the others play one action sampled
+// from their current strategy. Traversals update one shared set of regret
+// and strategy sums with relaxed atomic adds (lock free; a lost race only
+// costs some noise), so any number of threads can train at once.
+//
+// With -c the sums are checkpointed every -C seconds (written to a
+// temporary file, then renamed over the old one) and -r resumes from one.
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "poker.h"
+#include "engine.h"
+#include "strategy.h"
+#include "platform.h"
+#include "rng.h"
+
+#define CFR_MAX_THREADS 256
+// Raises allowed per street while training, keeps traversals small
+#define CFR_MAX_RAISES 2
+// Fixed point of the sums: regrets in 1/256 chip, strategy weights in 1/65536
+#define CFR_REGRET_SCALE 256.0
+#define CFR_STRATEGY_SCALE 65536.0
+// Iterations a worker claims at a time
+#define CFR_CHUNK 64
+
+#define CFR_MAGIC "HLDMCFR"
+#define CFR_VERSION 1
+
+typedef struct {
+    _Atomic int64_t regret[STRATEGY_INFOSETS][STRATEGY_ACTIONS];
+    _Atomic int64_t strategy[STRATEGY_INFOSETS][STRATEGY_ACTIONS];
+} CfrSums;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t infosets;
+    uint32_t actions;
+    uint32_t ehs_buckets; // Trained with -B
+    uint64_t iterations;
+} CfrCheckpointHeader;
+
+typedef struct {
+    CfrSums* sums;
+    _Atomic uint64_t* next; // Next iteration to claim
+    uint64_t end;
+    _Atomic bool* stop;
+    uint64_t seed;
+    _Atomic uint64_t done; // Read by the main thread for checkpoints
+    uint64_t nodes;
+} CfrWorker;
+
+// Card buckets of every seat on every street of the dealt hand
+typedef uint8_t CfrBuckets[MAX_PLAYERS][4];
+
+static double cfr_now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Regret matching: play actions in proportion to their positive regret
+static void cfr_current_strategy(CfrSums* sums, uint16_t infoset, uint8_t legal, double* strategy) {
+    double total = 0;
+    uint8_t count = 0;
+    for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+        strategy[a] = 0;
+        if(!(legal & (1 << a))) continue;
+        int64_t regret = atomic_load_explicit(&sums->regret[infoset][a], memory_order_relaxed);
+        if(regret > 0) strategy[a] = (double)regret;
+        total += strategy[a];
+        count++;
+    }
+    for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+        if(!(legal & (1 << a))) continue;
+        strategy[a] = total > 0 ? strategy[a] / total : 1.0 / count;
+    }
+}
+
+// Chips `traverser` wins or loses over the hand
+static double cfr_traverse(
+    CfrWorker* worker,
+    GameState* game,
+    uint8_t traverser,
+    uint8_t raises,
+    CfrBuckets buckets,
+    Rng* rng) {
+    worker->nodes++;
+    if(game->phase == PHASE_SHOWDOWN) {
+        ShowdownResult result;
+        engine_showdown(game, &result);
+        return (double)game->players[traverser].chips - STARTING_CHIPS;
+    }
+
+    uint8_t seat = game->current_player;
+    Action actions[STRATEGY_ACTIONS];
+    uint8_t legal = strategy_actions(game, actions);
+    if(raises >= CFR_MAX_RAISES) {
+        legal &= (1 << STRATEGY_FOLD) | (1 << STRATEGY_CALL);
+    }
+
+    uint16_t infoset = strategy_infoset(game, seat, buckets[seat][game->phase]);
+    double strategy[STRATEGY_ACTIONS];
+    cfr_current_strategy(worker->sums, infoset, legal, strategy);
+
+    if(seat != traverser) {
+        // Opponent: average its strategy, then follow one sampled action
+        double roll = rng_float(rng);
+        uint8_t pick = STRATEGY_CALL;
+        for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+            if(!(legal & (1 << a))) continue;
+            atomic_fetch_add_explicit(&worker->sums->strategy[infoset][a],
+                                      (int64_t)(strategy[a] * CFR_STRATEGY_SCALE),
+                                      memory_order_relaxed);
+            if(roll < strategy[a] && pick == STRATEGY_CALL) {
+                pick = a;
+                roll = 2.0;
+            } else {
+                roll -= strategy[a];
+            }
+        }
+        GamePhase phase = game->phase;
+        engine_apply_action(game, actions[pick]);
+        uint8_t next_raises = game->phase != phase ? 0 : raises + (pick >= STRATEGY_RAISE_MIN);
+        return cfr_traverse(worker, game, traverser, next_raises, buckets, rng);
+    }
+
+    // Traverser: value of every action, then regret against their mix
+    double values[STRATEGY_ACTIONS] = {0};
+    double value = 0;
+    for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+        if(!(legal & (1 << a))) continue;
+        GameState next = *game;
+        engine_apply_action(&next, actions[a]);
+        uint8_t next_raises = next.phase != game->phase ? 0 : raises + (a >= STRATEGY_RAISE_MIN);
+        values[a] = cfr_traverse(worker, &next, traverser, next_raises, buckets, rng);
+        value += strategy[a] * values[a];
+    }
+    for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+        if(!(legal & (1 << a))) continue;
+        atomic_fetch_add_explicit(&worker->sums->regret[infoset][a],
+                                  (int64_t)((values[a] - value) * CFR_REGRET_SCALE),
+                                  memory_order_relaxed);
+    }
+    return value;
+}
+
+static void cfr_iteration(CfrWorker* worker, uint64_t iteration) {
+    GameState game;
+    Rng rng;
+    rng_seed(&rng, worker->seed, iteration);
+
+    // A fresh table with a random dealer; the deal is a function of the
+    // iteration, so training is reproducible on one thread
+    engine_init(&game, ((uint64_t)rng_next(&rng) << 32) | rng_next(&rng));
+    game.dealer = (uint8_t)rng_bounded(&rng, MAX_PLAYERS);
+    game.hand_number = rng_next(&rng);
+    engine_new_hand(&game);
+
+    // The board comes off the same deck in the same order later on
+    Deck deck = game.deck;
+    CardSet board[4] = {0};
+    board[PHASE_FLOP] = poker_card_bit(poker_deal_card(&deck));
+    board[PHASE_FLOP] |= poker_card_bit(poker_deal_card(&deck));
+    board[PHASE_FLOP] |= poker_card_bit(poker_deal_card(&deck));
+    board[PHASE_TURN] = board[PHASE_FLOP] | poker_card_bit(poker_deal_card(&deck));
+    board[PHASE_RIVER] = board[PHASE_TURN] | poker_card_bit(poker_deal_card(&deck));
+
+    CfrBuckets buckets;
+    for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+        for(uint8_t street = PHASE_PREFLOP; street <= PHASE_RIVER; street++) {
+            buckets[seat][street] = strategy_bucket(game.players[seat].hand_set, board[street]);
+        }
+    }
+
+    for(uint8_t traverser = 0; traverser < MAX_PLAYERS; traverser++) {
+        GameState copy = game;
+        cfr_traverse(worker, &copy, traverser, 0, buckets, &rng);
+    }
+}
+
+static void* cfr_thread(void* ctx) {
+    CfrWorker* worker = (CfrWorker*)ctx;
+    uint64_t done = 0;
+
+    while(!atomic_load_explicit(worker->stop, memory_order_relaxed)) {
+        uint64_t first = atomic_fetch_add_explicit(worker->next, CFR_CHUNK, memory_order_relaxed);
+        if(first >= worker->end) break;
+        uint64_t last = first + CFR_CHUNK < worker->end ? first + CFR_CHUNK : worker->end;
+        for(uint64_t iteration = first; iteration < last; iteration++) {
+            cfr_iteration(worker, iteration);
+        }
+        done += last - first;
+        atomic_store_explicit(&worker->done, done, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+// Snapshot of the sums while training goes on; written next to `path` and
+// renamed over it, so a crash never leaves a torn checkpoint
+static bool cfr_save_checkpoint(const char* path, CfrSums* sums, uint64_t iterations, bool ehs_buckets) {
+    char temp[1024];
+    snprintf(temp, sizeof(temp), "%s.tmp", path);
+    FILE* file = fopen(temp, "wb");
+    if(!file) return false;
+
+    CfrCheckpointHeader header = {
+        .magic = CFR_MAGIC,
+        .version = CFR_VERSION,
+        .infosets = STRATEGY_INFOSETS,
+        .actions = STRATEGY_ACTIONS,
+        .ehs_buckets = ehs_buckets,
+        .iterations = iterations,
+    };
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+    for(uint16_t i = 0; i < STRATEGY_INFOSETS && written; i++) {
+        int64_t row[2][STRATEGY_ACTIONS];
+        for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+            row[0][a] = atomic_load_explicit(&sums->regret[i][a], memory_order_relaxed);
+            row[1][a] = atomic_load_explicit(&sums->strategy[i][a], memory_order_relaxed);
+        }
+        written = fwrite(row, sizeof(row), 1, file) == 1;
+    }
+    if(fclose(file) != 0) written = false;
+    return written && rename(temp, path) == 0;
+}
+
+static bool cfr_load_checkpoint(const char* path, CfrSums* sums, uint64_t* iterations, bool ehs_buckets) {
+    FILE* file = fopen(path, "rb");
+    if(!file) return false;
+
+    CfrCheckpointHeader header;
+    bool read = fread(&header, sizeof(header), 1, file) == 1 && !memcmp(header.magic, CFR_MAGIC, 8) &&
+                header.version == CFR_VERSION && header.infosets == STRATEGY_INFOSETS &&
+                header.actions == STRATEGY_ACTIONS && header.ehs_buckets == ehs_buckets;
+    for(uint16_t i = 0; i < STRATEGY_INFOSETS && read; i++) {
+        int64_t row[2][STRATEGY_ACTIONS];
+        read = fread(row, sizeof(row), 1, file) == 1;
+        for(uint8_t a = 0; a < STRATEGY_ACTIONS && read; a++) {
+            atomic_init(&sums->regret[i][a], row[0][a]);
+            atomic_init(&sums->strategy[i][a], row[1][a]);
+        }
+    }
+    fclose(file);
+    *iterations = header.iterations;
+    return read;
+}
+
+// Average strategy as 4-bit weights. Information sets training never
+// reached stay all zero (the bot checks or calls there).
+static uint32_t cfr_write_table(FILE* out, CfrSums* sums, uint64_t iterations, uint64_t seed, bool ehs_buckets) {
+    uint32_t reached = 0;
+
+    fprintf(out, "// Generated by host/holdem_cfr.c (%" PRIu64 " iterations, seed %" PRIu64 "),\n",
+            iterations, seed);
+    fprintf(out, "// do not edit. Regenerate with: make -C host strategy-table\n");
+    if(ehs_buckets) fprintf(out, "// Trained on holdem-buckets EHS tables: play it with the same tables (-B)\n");
+    fprintf(out, "\n");
+    fprintf(out, "#include \"strategy.h\"\n\n");
+    fprintf(out, "const uint8_t strategy_table[STRATEGY_INFOSETS][STRATEGY_TABLE_BYTES] = {\n");
+    for(uint16_t i = 0; i < STRATEGY_INFOSETS; i++) {
+        double weights[STRATEGY_ACTIONS];
+        double total = 0;
+        for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+            weights[a] = (double)atomic_load_explicit(&sums->strategy[i][a], memory_order_relaxed);
+            total += weights[a];
+        }
+
+        uint8_t nibbles[STRATEGY_TABLE_BYTES * 2] = {0};
+        if(total > 0) {
+            reached++;
+            uint8_t best = 0;
+            for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+                nibbles[a] = (uint8_t)(weights[a] / total * STRATEGY_WEIGHT_MAX + 0.5);
+                if(weights[a] > weights[best]) best = a;
+            }
+            // Rounding must not drop every action
+            if(nibbles[best] == 0) nibbles[best] = 1;
+        }
+
+        // One line per bucket run, labelled with the rest of the infoset
+        uint8_t bucket = i % STRATEGY_BUCKETS;
+        fprintf(out, "%s{", bucket ? " " : "    ");
+        for(uint8_t b = 0; b < STRATEGY_TABLE_BYTES; b++) {
+            fprintf(out, "%s0x%02x", b ? ", " : "", nibbles[b * 2] | nibbles[b * 2 + 1] << 4);
+        }
+        fprintf(out, "},");
+        if(bucket == STRATEGY_BUCKETS - 1) {
+            uint16_t rest = i / STRATEGY_BUCKETS;
+            uint8_t level = rest % STRATEGY_BET_LEVELS;
+            rest /= STRATEGY_BET_LEVELS;
+            uint8_t players = rest % (MAX_PLAYERS - 1) + 2;
+            rest /= MAX_PLAYERS - 1;
+            fprintf(out, " // %s, seat %u after dealer, %u players, bet level %u\n",
+                    buckets_street_names[rest / MAX_PLAYERS], rest % MAX_PLAYERS, players, level);
+        }
+    }
+    fprintf(out, "};");
+    return reached;
+}
+
+static void cfr_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-n iterations] [-t seconds] [-j threads] [-s seed] [-c file [-C seconds]] [-r file] [-B dir] [-o file]\n"
+            "  -n n      iterations to train, one hand traversed for every seat (default 1000000)\n"
+            "  -t s      stop after this many seconds instead\n"
+            "  -j n      worker threads (default one per core)\n"
+            "  -s seed   random seed (default 1)\n"
+            "  -c file   checkpoint file, rewritten every -C seconds (default 60)\n"
+            "  -r file   resume from a checkpoint\n"
+            "  -B dir    card buckets from holdem-buckets tables in dir\n"
+            "  -o file   write the strategy table (C source) here\n",
+            argv0);
+}
+
+int main(int argc, char** argv) {
+    uint64_t iterations = 1000000;
+    uint32_t time_limit = 0;
+    uint32_t threads = 0;
+    uint64_t seed = 1;
+    const char* checkpoint_path = NULL;
+    uint32_t checkpoint_seconds = 60;
+    const char* resume_path = NULL;
+    const char* output_path = NULL;
+    const char* buckets_dir = NULL;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc) {
+            iterations = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+            time_limit = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-j") && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-s") && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-c") && i + 1 < argc) {
+            checkpoint_path = argv[++i];
+        } else if(!strcmp(argv[i], "-C") && i + 1 < argc) {
+            checkpoint_seconds = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-r") && i + 1 < argc) {
+            resume_path = argv[++i];
+        } else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+            output_path = argv[++i];
+        } else if(!strcmp(argv[i], "-B") && i + 1 < argc) {
+            buckets_dir = argv[++i];
+        } else {
+            cfr_usage(argv[0]);
+            return 1;
+        }
+    }
+    if(time_limit) iterations = UINT64_MAX;
+
+    if(threads == 0) threads = platform_cpu_count();
+    if(threads > CFR_MAX_THREADS) threads = CFR_MAX_THREADS;
+
+    BucketTable tables[BUCKETS_STREETS];
+    if(buckets_dir) {
+        if(!buckets_map_streets(tables, buckets_dir)) {
+            fprintf(stderr, "%s: no holdem-buckets tables\n", buckets_dir);
+            return 1;
+        }
+        strategy_set_buckets(tables);
+    }
+
+    CfrSums* sums = calloc(1, sizeof(CfrSums));
+    uint64_t start_iteration = 0;
+    if(resume_path && !cfr_load_checkpoint(resume_path, sums, &start_iteration, buckets_dir != NULL)) {
+        fprintf(stderr, "%s: not a checkpoint of this abstraction\n", resume_path);
+        return 1;
+    }
+    // Resuming continues the same sequence of deals
+    uint64_t end = time_limit || iterations > UINT64_MAX - start_iteration ? UINT64_MAX :
+                                                                            start_iteration + iterations;
+
+    _Atomic uint64_t next = start_iteration;
+    _Atomic bool stop = false;
+    CfrWorker* workers = calloc(threads, sizeof(CfrWorker));
+    pthread_t* handles = calloc(threads, sizeof(pthread_t));
+
+    poker_eval_init();
+    double start = cfr_now_seconds();
+    for(uint32_t i = 0; i < threads; i++) {
+        workers[i].sums = sums;
+        workers[i].next = &next;
+        workers[i].end = end;
+        workers[i].stop = &stop;
+        workers[i].seed = seed;
+        atomic_init(&workers[i].done, 0);
+        pthread_create(&handles[i], NULL, cfr_thread, &workers[i]);
+    }
+
+    // Progress, time limit and checkpoints from the main thread
+    double last_checkpoint = start;
+    while(true) {
+        struct timespec pause = {0, 100 * 1000000};
+        nanosleep(&pause, NULL);
+        double now = cfr_now_seconds();
+        uint64_t claimed = atomic_load_explicit(&next, memory_order_relaxed);
+        if(claimed >= end) break;
+        if(time_limit && now - start >= time_limit) break;
+        if(checkpoint_path && now - last_checkpoint >= checkpoint_seconds) {
+            // Iterations in flight are partly in the snapshot; resuming redoes them
+            uint64_t done = 0;
+            for(uint32_t i = 0; i < threads; i++) {
+                done += atomic_load_explicit(&workers[i].done, memory_order_relaxed);
+            }
+            if(!cfr_save_checkpoint(checkpoint_path, sums, start_iteration + done, buckets_dir != NULL)) {
+                fprintf(stderr, "%s: checkpoint failed\n", checkpoint_path);
+            }
+            last_checkpoint = now;
+        }
+    }
+    atomic_store_explicit(&stop, true, memory_order_relaxed);
+    for(uint32_t i = 0; i < threads; i++) {
+        pthread_join(handles[i], NULL);
+    }
+    double elapsed = cfr_now_seconds() - start;
+
+    uint64_t done = 0, nodes = 0;
+    for(uint32_t i = 0; i < threads; i++) {
+        done += atomic_load_explicit(&workers[i].done, memory_order_relaxed);
+        nodes += workers[i].nodes;
+    }
+    uint64_t total = start_iteration + done;
+
+    if(checkpoint_path && !cfr_save_checkpoint(checkpoint_path, sums, total, buckets_dir != NULL)) {
+        fprintf(stderr, "%s: checkpoint failed\n", checkpoint_path);
+        return 1;
+    }
+
+    uint32_t reached = 0;
+    if(output_path) {
+        FILE* out = fopen(output_path, "w");
+        if(!out) {
+            perror(output_path);
+            return 1;
+        }
+        reached = cfr_write_table(out, sums, total, seed, buckets_dir != NULL);
+        if(fclose(out) != 0) {
+            fprintf(stderr, "%s: write failed\n", output_path);
+            return 1;
+        }
+    }
+
+    printf("iterations:      %" PRIu64 " (%" PRIu64 " this run)\n", total, done);
+    printf("threads:         %u\n", threads);
+    printf("seconds:         %.3f\n", elapsed);
+    printf("iterations/sec:  %.0f\n", elapsed > 0 ? done / elapsed : 0.0);
+    printf("nodes/sec:       %.0f\n", elapsed > 0 ? nodes / elapsed : 0.0);
+    printf("infosets:        %u", STRATEGY_INFOSETS);
+    if(output_path) printf(" (%u reached)", reached);
+    printf("\ntable size:      %u bytes (%u actions at 4 bits)\n",
+           (unsigned)sizeof(strategy_table), STRATEGY_ACTIONS);
+
+    free(handles);
+    free(workers);
+    free(sums);
+    if(buckets_dir) {
+        strategy_set_buckets(NULL);
+        for(uint8_t street = 0; street < BUCKETS_STREETS; street++) {
+            buckets_map_close(&tables[street]);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
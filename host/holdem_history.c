@@ -0,0 +1,298 @@
+// holdem-history: reads binary hand histories written by holdem-sim -w.
+//
+// The file is mapped, not read: records are used in place straight from the
+// page cache, so scanning a multi-gigabyte history costs about as much as
+// reading it from disk once.
+//
+// -t exports a binary history as PokerStars-style text for other tools; -i
+// imports such text (ours or a real site's) and replays every showdown
+// through the evaluator and the AI's strength estimates.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "poker.h"
+#include "hand_history.h"
+#include "hand_text.h"
+#include "ai.h"
+#include "preflop.h"
+#include "platform.h"
+
+static const char* action_names[] = {"folds", "checks", "calls", "raises to"};
+static const char* street_names[] = {"preflop", "flop", "turn", "river"};
+
+typedef struct {
+    uint64_t hands_won;
+    uint64_t hands_dealt;
+    uint64_t vpip; // Voluntarily put chips in preflop (called or raised)
+    uint64_t preflop_raises;
+} HistorySeatStats;
+
+// What replaying imported showdowns found
+typedef struct {
+    uint64_t showdowns; // Hands with a full board and two or more hands shown
+    uint64_t agreed; // Our evaluator picks exactly the players who collected
+    uint64_t shown;
+    double preflop_winner;
+    double preflop_loser;
+    double river_winner;
+    double river_loser;
+    uint64_t winners;
+    uint64_t losers;
+} HistoryImport;
+
+static void history_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s file [-p index] [-t text|-]\n"
+            "       %s -i text|-\n"
+            "  -p index  print one hand (0 = first record) instead of the summary\n"
+            "  -t file   export every hand as PokerStars-style text (\"-\" = stdout)\n"
+            "  -i file   import PokerStars-style text and replay its showdowns\n",
+            argv0,
+            argv0);
+}
+
+static void history_import_hand(const HandTextHand* hand, void* context) {
+    HistoryImport* import = (HistoryImport*)context;
+    const HandTextSeat* shown[HAND_TEXT_MAX_SEATS];
+    uint16_t strength[HAND_TEXT_MAX_SEATS];
+    uint8_t shown_count = 0;
+    uint16_t best = 0;
+
+    if(!hand->showdown || hand->board_count != COMMUNITY_SIZE) return;
+    for(uint8_t i = 0; i < hand->seat_count; i++) {
+        const HandTextSeat* seat = &hand->seats[i];
+        if(seat->folded || !seat->hole_known) continue;
+        Card hole[HAND_SIZE] = {seat->hole[0], seat->hole[1]};
+        strength[shown_count] = poker_evaluate_hand(hole, (Card*)hand->board, COMMUNITY_SIZE).strength;
+        if(strength[shown_count] > best) best = strength[shown_count];
+        shown[shown_count++] = seat;
+    }
+    if(shown_count < 2) return;
+
+    // Side pots can pay a worse hand, so only exact agreement counts
+    bool agreed = true;
+    uint8_t opponents = shown_count - 1;
+    for(uint8_t i = 0; i < shown_count; i++) {
+        bool best_hand = strength[i] == best;
+        bool collected = shown[i]->collected > 0;
+        if(best_hand != collected) agreed = false;
+
+        Card hole[HAND_SIZE] = {shown[i]->hole[0], shown[i]->hole[1]};
+        float preflop = preflop_equity(poker_cards_to_set(hole, HAND_SIZE), opponents);
+        float river = ai_evaluate_hand_strength(hole, (Card*)hand->board, COMMUNITY_SIZE);
+        if(best_hand) {
+            import->preflop_winner += preflop;
+            import->river_winner += river;
+            import->winners++;
+        } else {
+            import->preflop_loser += preflop;
+            import->river_loser += river;
+            import->losers++;
+        }
+    }
+
+    import->showdowns++;
+    import->agreed += agreed;
+    import->shown += shown_count;
+}
+
+static int history_import(const char* path) {
+    FILE* in = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+    if(!in) {
+        perror(path);
+        return 1;
+    }
+
+    HistoryImport import = {0};
+    HandTextStats stats;
+    uint64_t start = platform_time_us();
+    bool ok = hand_text_import(in, history_import_hand, &import, &stats);
+    double elapsed = (platform_time_us() - start) * 1e-6;
+    if(in != stdin) fclose(in);
+    if(!ok) {
+        fprintf(stderr, "%s: read failed\n", path);
+        return 1;
+    }
+
+    double winners = import.winners ? (double)import.winners : 1.0;
+    double losers = import.losers ? (double)import.losers : 1.0;
+    printf("hands:      %" PRIu64 " (%" PRIu64 " lines, %" PRIu64 " too long)\n",
+           stats.hands, stats.lines, stats.skipped_lines);
+    printf("showdowns:  %" PRIu64 ", evaluator agrees with the payout in %" PRIu64 "\n",
+           import.showdowns, import.agreed);
+    printf("import:     %.3f s, %.0f hands/sec, %.0f MB/s\n",
+           elapsed,
+           elapsed > 0 ? stats.hands / elapsed : 0.0,
+           elapsed > 0 ? stats.bytes / elapsed / 1e6 : 0.0);
+    printf("\nat showdown   preflop_equity  river_strength\n");
+    printf("best hand     %.4f          %.4f\n", import.preflop_winner / winners, import.river_winner / winners);
+    printf("beaten hand   %.4f          %.4f\n", import.preflop_loser / losers, import.river_loser / losers);
+    return 0;
+}
+
+static int history_export(const HandHistoryMap* map, const char* path) {
+    FILE* out = strcmp(path, "-") ? fopen(path, "w") : stdout;
+    if(!out) {
+        perror(path);
+        return 1;
+    }
+
+    uint64_t skipped = 0;
+    for(uint64_t i = 0; i < map->count; i++) {
+        skipped += !hand_text_export(out, &map->records[i]);
+    }
+
+    bool ok = !ferror(out);
+    if(out != stdout && fclose(out) != 0) ok = false;
+    if(!ok) {
+        fprintf(stderr, "%s: write failed\n", path);
+        return 1;
+    }
+    if(skipped) {
+        fprintf(stderr, "%" PRIu64 " truncated hands not exported\n", skipped);
+    }
+    return 0;
+}
+
+static void history_print_cards(const Card* cards, uint8_t count) {
+    char text[4];
+    for(uint8_t i = 0; i < count && cards[i] != HAND_HISTORY_NO_CARD; i++) {
+        poker_get_card_string(cards[i], text, sizeof(text));
+        printf(" %s", text);
+    }
+}
+
+static void history_print_hand(const HandRecord* record) {
+    printf("seed %" PRIu64 " hand %" PRIu32 "  blinds %u/%u  dealer %u\n",
+           record->seed, record->hand_number, record->small_blind, record->big_blind, record->dealer);
+    for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+        printf("seat %u: %4u chips ", seat, record->stacks[seat]);
+        history_print_cards(record->hole[seat], HAND_SIZE);
+        printf("\n");
+    }
+
+    uint8_t street = 0;
+    for(uint8_t i = 0; i < record->action_count; i++) {
+        while(street < 3 && i >= record->street_start[street]) street++;
+        uint16_t packed = record->actions[i];
+        Action action = hand_history_action(packed);
+        printf("%-7s seat %u %s", street_names[street], hand_history_action_seat(packed), action_names[action.type]);
+        if(action.type == ACTION_RAISE) printf(" %" PRIu32, action.amount);
+        printf("\n");
+    }
+    if(record->flags & HAND_HISTORY_FLAG_TRUNCATED) printf("(further actions not recorded)\n");
+
+    printf("board:");
+    history_print_cards(record->board, COMMUNITY_SIZE);
+    printf("\npot %u to", record->pot);
+    for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+        if(record->winners & (1 << seat)) printf(" seat %u", seat);
+    }
+    printf("%s\n", record->flags & HAND_HISTORY_FLAG_SHOWDOWN ? " at showdown" : "");
+}
+
+int main(int argc, char** argv) {
+    const char* path = NULL;
+    const char* text_out = NULL;
+    const char* text_in = NULL;
+    int64_t print_index = -1;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-p") && i + 1 < argc) {
+            print_index = strtoll(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+            text_out = argv[++i];
+        } else if(!strcmp(argv[i], "-i") && i + 1 < argc) {
+            text_in = argv[++i];
+        } else if(argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            history_usage(argv[0]);
+            return 1;
+        }
+    }
+    poker_eval_init();
+    if(text_in) {
+        return history_import(text_in);
+    }
+    if(!path) {
+        history_usage(argv[0]);
+        return 1;
+    }
+
+    HandHistoryMap map;
+    if(!hand_history_map_open(&map, path)) {
+        fprintf(stderr, "%s: not a hand history file\n", path);
+        return 1;
+    }
+
+    if(text_out) {
+        int status = history_export(&map, text_out);
+        hand_history_map_close(&map);
+        return status;
+    }
+
+    if(print_index >= 0) {
+        if((uint64_t)print_index >= map.count) {
+            fprintf(stderr, "%s: only %" PRIu64 " hands\n", path, map.count);
+            hand_history_map_close(&map);
+            return 1;
+        }
+        history_print_hand(&map.records[print_index]);
+        hand_history_map_close(&map);
+        return 0;
+    }
+
+    HistorySeatStats seats[MAX_PLAYERS] = {0};
+    uint64_t showdowns = 0, truncated = 0, actions = 0, pot_sum = 0;
+
+    uint64_t start = platform_time_us();
+    for(uint64_t i = 0; i < map.count; i++) {
+        const HandRecord* record = &map.records[i];
+        showdowns += (record->flags & HAND_HISTORY_FLAG_SHOWDOWN) != 0;
+        truncated += (record->flags & HAND_HISTORY_FLAG_TRUNCATED) != 0;
+        actions += record->action_count;
+        pot_sum += record->pot;
+
+        bool voluntary[MAX_PLAYERS] = {false};
+        for(uint8_t a = 0; a < record->street_start[0]; a++) {
+            uint8_t seat = hand_history_action_seat(record->actions[a]);
+            PlayerAction type = hand_history_action(record->actions[a]).type;
+            if(type == ACTION_CALL || type == ACTION_RAISE) voluntary[seat] = true;
+            if(type == ACTION_RAISE) seats[seat].preflop_raises++;
+        }
+        for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+            seats[seat].hands_won += (record->winners >> seat) & 1;
+            seats[seat].hands_dealt += record->hole[seat][0] != HAND_HISTORY_NO_CARD;
+            seats[seat].vpip += voluntary[seat];
+        }
+    }
+    double elapsed = (platform_time_us() - start) * 1e-6;
+
+    double hands = map.count ? (double)map.count : 1.0;
+    printf("hands:      %" PRIu64 "\n", map.count);
+    printf("showdowns:  %.4f\n", showdowns / hands);
+    printf("truncated:  %" PRIu64 "\n", truncated);
+    printf("actions:    %.2f per hand\n", actions / hands);
+    printf("pot:        %.1f average\n", pot_sum / hands);
+    printf("scan:       %.3f s, %.0f hands/sec, %.0f MB/s\n",
+           elapsed,
+           elapsed > 0 ? map.count / elapsed : 0.0,
+           elapsed > 0 ? map.count * sizeof(HandRecord) / elapsed / 1e6 : 0.0);
+    printf("\nseat  dealt      won        vpip    preflop_raises\n");
+    for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+        double dealt = seats[seat].hands_dealt ? (double)seats[seat].hands_dealt : 1.0;
+        printf("%-4u  %9" PRIu64 "  %9" PRIu64 "  %.4f  %" PRIu64 "\n",
+               seat,
+               seats[seat].hands_dealt,
+               seats[seat].hands_won,
+               seats[seat].vpip / dealt,
+               seats[seat].preflop_raises);
+    }
+
+    hand_history_map_close(&map);
+    return 0;
+}
\ No newline at end of file
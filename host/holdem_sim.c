@@ -0,0 +1,395 @@
+// holdem-sim: plays AI-vs-AI hands on the host with no UI and no delays.
+//
+// Every seat is driven by ai_decide. When one player has won all the
+// chips the table is reset and a new match starts, so long runs measure the
+// personalities over many independent matches.
+//
+// With -w every hand is appended to a binary hand history (hand_history.h).
+// With -T (tracing build) the run is recorded as a Chrome trace (trace.h).
+//
+// With -e it instead computes hand equity, for one spot or for a stream of
+// spots on stdin ("AhKs 2c7d9h 2" = hole, board or "-", opponents).
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "poker.h"
+#include "engine.h"
+#include "ai.h"
+#include "equity.h"
+#include "hand_history.h"
+#include "strategy.h"
+#include "profile.h"
+#include "trace.h"
+#include "platform.h"
+
+typedef struct {
+    uint64_t hands_won;
+    uint64_t matches_won;
+    int64_t chips_won;
+} SeatStats;
+
+static const char* personality_names[] = {"conservative", "aggressive", "random", "strategy"};
+static const char* difficulty_names[] = {"easy", "medium", "hard"};
+
+static double sim_now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool sim_file_sink(void* context, const void* data, size_t size) {
+    return fwrite(data, 1, size, (FILE*)context) == size;
+}
+
+static void sim_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-n hands] [-s seed] [-r hand] [-H seat] [-P seat [-B dir]] [-w file] [-T file [-k n]] [-v]\n"
+            "       %s -e hole|- [-b board] [-o opponents] [-i iterations] [-t ms] [-j threads] [-x|-m]\n"
+            "  -n hands  number of hands to play (default 100000)\n"
+            "  -s seed   random seed (default 1)\n"
+            "  -r hand   print the deal of one hand number for this seed and exit\n"
+            "  -H seat   make a seat play as AI_HARD (tree search), may repeat\n"
+            "  -P seat   make a seat play the trained strategy table (AI_STRATEGY), may repeat\n"
+            "  -B dir    strategy card buckets from holdem-buckets tables (as trained)\n"
+            "  -w file   append every hand to a binary hand history file\n"
+            "  -T file   write a Chrome trace of the run (make TRACE=1 builds)\n"
+            "  -k n      trace only every n-th hand (default 1)\n"
+            "  -v        print every hand result\n"
+            "  -e hole   compute equity of hole cards, \"-\" reads spots from stdin\n"
+            "  -b board  known community cards (default none)\n"
+            "  -o n      number of random opponents (default 1)\n"
+            "  -i n      rollouts (default 1000000 unless -t is given)\n"
+            "  -t ms     time budget in milliseconds\n"
+            "  -j n      worker threads (default one per core), or search threads of -H seats\n"
+            "  -x        exact enumeration (one opponent only)\n"
+            "  -m        Monte Carlo even when exact enumeration is cheap\n",
+            argv0,
+            argv0);
+}
+
+static void sim_print_equity(const char* hole_text, const char* board_text, uint8_t opponents, EquityBudget* budget) {
+    CardSet hole, board = 0;
+
+    if(poker_parse_cards(hole_text, &hole) != HAND_SIZE ||
+       (board_text && strcmp(board_text, "-") && poker_parse_cards(board_text, &board) < 0) ||
+       poker_set_count(board) > COMMUNITY_SIZE || (hole & board) || opponents == 0 ||
+       opponents > 22 || (budget->mode == EQUITY_EXACT && opponents != 1)) {
+        fprintf(stderr, "bad spot: %s %s %u\n", hole_text, board_text ? board_text : "-", opponents);
+        return;
+    }
+
+    uint64_t start = platform_time_us();
+    EquityResult result = equity_calculate(hole, board, opponents, budget);
+    double elapsed = (platform_time_us() - start) * 1e-6;
+
+    printf("%s %s %u  equity %.4f +/- %.4f  win %.4f  tie %.4f  (%" PRIu32 " %s, %.0f/s)\n",
+           hole_text, board_text ? board_text : "-", opponents,
+           result.equity, result.ci95, result.win, result.tie, result.iterations,
+           result.exact ? "matchups" : "rollouts",
+           elapsed > 0 ? result.iterations / elapsed : 0.0);
+}
+
+static void sim_equity_stdin(EquityBudget* budget) {
+    char line[128], hole[32], board[32];
+    unsigned opponents;
+
+    while(fgets(line, sizeof(line), stdin)) {
+        if(sscanf(line, "%31s %31s %u", hole, board, &opponents) == 3) {
+            sim_print_equity(hole, board, (uint8_t)opponents, budget);
+        }
+    }
+}
+
+static void sim_new_match(GameState* game, AIPlayer* ai_players, uint64_t seed, uint32_t hand_number) {
+    // Hand numbers keep counting across matches so every hand of the run
+    // has its own deal
+    engine_init(game, seed);
+    game->hand_number = hand_number;
+
+    // ai_init_players sets up the three app opponents; seat 0 (the human
+    // seat on the device) gets a copy of the balanced bot
+    ai_init_players(&ai_players[1]);
+    ai_players[0] = ai_players[MAX_PLAYERS - 1];
+}
+
+static void sim_apply_difficulty(AIPlayer* ai_players, bool* hard_seats, uint8_t search_threads) {
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(!hard_seats[i]) continue;
+        ai_players[i].difficulty = AI_HARD;
+        ai_players[i].search_threads = search_threads;
+    }
+}
+
+static void sim_apply_strategy(AIPlayer* ai_players, bool* strategy_seats) {
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(strategy_seats[i]) ai_players[i].personality = AI_STRATEGY;
+    }
+}
+
+// `record` may be NULL when no history is written
+static void sim_play_hand(GameState* game, AIPlayer* ai_players, HandRecord* record) {
+    engine_new_hand(game);
+    if(record) hand_history_begin(record, game);
+    TRACE_STREET(PHASE_SHOWDOWN, game->phase);
+
+    while(game->phase != PHASE_SHOWDOWN) {
+        uint8_t seat = game->current_player;
+        GamePhase phase = game->phase;
+        Action action = engine_apply_action(game, ai_decide(game, seat, &ai_players[seat]));
+        if(record) hand_history_add_action(record, phase, seat, action);
+        TRACE_STREET(phase, game->phase);
+
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            ai_update_opponent_model(&ai_players[i], seat, action.type);
+        }
+    }
+}
+
+// Deals are a pure function of (seed, hand number), so any hand of a run
+// can be reproduced without replaying the ones before it
+static void sim_print_deal(uint64_t seed, uint32_t hand_number) {
+    GameState game;
+    char card[4];
+
+    engine_init(&game, seed);
+    game.hand_number = hand_number - 1;
+    engine_new_hand(&game);
+
+    printf("seed %" PRIu64 " hand %" PRIu32 "\n", seed, hand_number);
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        printf("seat %u:", i);
+        for(uint8_t j = 0; j < HAND_SIZE; j++) {
+            poker_get_card_string(game.players[i].hand[j], card, sizeof(card));
+            printf(" %s", card);
+        }
+        printf("\n");
+    }
+
+    // Board in dealing order: the next five cards after the hole cards
+    printf("board:");
+    for(uint8_t i = 0; i < COMMUNITY_SIZE; i++) {
+        poker_get_card_string(poker_deal_card(&game.deck), card, sizeof(card));
+        printf(" %s", card);
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    uint64_t hands = 100000;
+    uint64_t seed = 1;
+    uint32_t replay_hand = 0;
+    bool verbose = false;
+    bool hard_seats[MAX_PLAYERS] = {false};
+    bool strategy_seats[MAX_PLAYERS] = {false};
+    const char* history_path = NULL;
+    const char* trace_path = NULL;
+    uint32_t trace_every = 1;
+    const char* buckets_dir = NULL;
+    const char* equity_hole = NULL;
+    const char* equity_board = NULL;
+    uint8_t equity_opponents = 1;
+    EquityBudget budget = {0};
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i + 1 < argc) {
+            hands = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-s") && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-r") && i + 1 < argc) {
+            replay_hand = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-H") && i + 1 < argc) {
+            unsigned seat = (unsigned)strtoul(argv[++i], NULL, 10);
+            if(seat < MAX_PLAYERS) hard_seats[seat] = true;
+        } else if(!strcmp(argv[i], "-P") && i + 1 < argc) {
+            unsigned seat = (unsigned)strtoul(argv[++i], NULL, 10);
+            if(seat < MAX_PLAYERS) strategy_seats[seat] = true;
+        } else if(!strcmp(argv[i], "-B") && i + 1 < argc) {
+            buckets_dir = argv[++i];
+        } else if(!strcmp(argv[i], "-e") && i + 1 < argc) {
+            equity_hole = argv[++i];
+        } else if(!strcmp(argv[i], "-b") && i + 1 < argc) {
+            equity_board = argv[++i];
+        } else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+            equity_opponents = (uint8_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-i") && i + 1 < argc) {
+            budget.max_iterations = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+            budget.max_time_us = (uint32_t)strtoul(argv[++i], NULL, 10) * 1000;
+        } else if(!strcmp(argv[i], "-j") && i + 1 < argc) {
+            budget.threads = (uint8_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-x")) {
+            budget.mode = EQUITY_EXACT;
+        } else if(!strcmp(argv[i], "-m")) {
+            budget.mode = EQUITY_MONTE_CARLO;
+        } else if(!strcmp(argv[i], "-w") && i + 1 < argc) {
+            history_path = argv[++i];
+        } else if(!strcmp(argv[i], "-T") && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if(!strcmp(argv[i], "-k") && i + 1 < argc) {
+            trace_every = (uint32_t)strtoul(argv[++i], NULL, 10);
+            if(trace_every == 0) trace_every = 1;
+        } else if(!strcmp(argv[i], "-v")) {
+            verbose = true;
+        } else {
+            sim_usage(argv[0]);
+            return 1;
+        }
+    }
+    // Before any search or equity worker reads the tables
+    poker_eval_init();
+
+    if(replay_hand > 0) {
+        sim_print_deal(seed, replay_hand);
+        return 0;
+    }
+
+    if(equity_hole) {
+        budget.seed = seed;
+        if(budget.max_iterations == 0 && budget.max_time_us == 0) {
+            budget.max_iterations = 1000000;
+        }
+        if(!strcmp(equity_hole, "-")) {
+            sim_equity_stdin(&budget);
+        } else {
+            sim_print_equity(equity_hole, equity_board, equity_opponents, &budget);
+        }
+        return 0;
+    }
+
+    GameState game;
+    AIPlayer ai_players[MAX_PLAYERS];
+    SeatStats stats[MAX_PLAYERS] = {0};
+    uint64_t matches = 0;
+    FILE* history_file = NULL;
+    HandHistoryWriter* history = NULL;
+    HandRecord record;
+
+    if(history_path) {
+        history_file = fopen(history_path, "ab");
+        if(!history_file) {
+            perror(history_path);
+            return 1;
+        }
+        history = malloc(sizeof(HandHistoryWriter));
+        hand_history_writer_init(history, sim_file_sink, history_file);
+        fseek(history_file, 0, SEEK_END);
+        if(ftell(history_file) == 0) hand_history_write_header(history);
+    }
+
+    if(trace_path) {
+#ifdef HOLDEM_TRACE
+        if(!trace_open(trace_path)) {
+            perror(trace_path);
+            return 1;
+        }
+        TRACE_THREAD_NAME("sim");
+#else
+        fprintf(stderr, "-T needs a tracing build (make -C host TRACE=1)\n");
+        return 1;
+#endif
+    }
+
+    BucketTable tables[BUCKETS_STREETS];
+    if(buckets_dir) {
+        if(!buckets_map_streets(tables, buckets_dir)) {
+            fprintf(stderr, "%s: no holdem-buckets tables\n", buckets_dir);
+            return 1;
+        }
+        strategy_set_buckets(tables);
+    }
+
+    // Hard seats search on one thread unless -j says otherwise
+    uint8_t search_threads = budget.threads ? budget.threads : 1;
+    sim_new_match(&game, ai_players, seed, 0);
+    sim_apply_difficulty(ai_players, hard_seats, search_threads);
+    sim_apply_strategy(ai_players, strategy_seats);
+
+    double start = sim_now_seconds();
+    for(uint64_t hand = 0; hand < hands; hand++) {
+        uint32_t chips_before[MAX_PLAYERS];
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            chips_before[i] = game.players[i].chips;
+        }
+
+        TRACE_SAMPLE(hand % trace_every == 0);
+        sim_play_hand(&game, ai_players, history ? &record : NULL);
+
+        ShowdownResult result;
+        uint8_t winner_count = engine_showdown(&game, &result);
+        const uint8_t* winners = result.winners;
+        if(history) {
+            hand_history_finish(&record, &game, result.pot, winners, winner_count);
+            hand_history_append(history, &record);
+        }
+
+        for(uint8_t i = 0; i < winner_count; i++) {
+            stats[winners[i]].hands_won++;
+        }
+        for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+            stats[i].chips_won += (int64_t)game.players[i].chips - chips_before[i];
+        }
+
+        if(verbose) {
+            printf("hand %" PRIu32 ": winner AI%u share %" PRIu32 "\n",
+                   game.hand_number, winners[0], result.won[winners[0]]);
+        }
+
+        if(engine_players_with_chips(&game) < 2) {
+            stats[winners[0]].matches_won++;
+            matches++;
+            sim_new_match(&game, ai_players, seed, game.hand_number);
+            sim_apply_difficulty(ai_players, hard_seats, search_threads);
+            sim_apply_strategy(ai_players, strategy_seats);
+        }
+    }
+    double elapsed = sim_now_seconds() - start;
+
+#ifdef HOLDEM_TRACE
+    if(trace_path) {
+        TraceStats trace_stats;
+        if(!trace_close(&trace_stats)) {
+            fprintf(stderr, "%s: write failed\n", trace_path);
+            return 1;
+        }
+        printf("trace:      %" PRIu64 " events, %" PRIu64 " dropped\n",
+               trace_stats.events, trace_stats.dropped);
+    }
+#endif
+
+    if(history) {
+        bool written = hand_history_flush(history);
+        if(fclose(history_file) != 0) written = false;
+        free(history);
+        if(!written) {
+            fprintf(stderr, "%s: write failed\n", history_path);
+            return 1;
+        }
+    }
+
+    printf("hands:      %" PRIu64 "\n", hands);
+    printf("matches:    %" PRIu64 "\n", matches);
+    printf("seconds:    %.3f\n", elapsed);
+    printf("hands/sec:  %.0f\n", elapsed > 0 ? hands / elapsed : 0.0);
+    printf("\nseat  personality   level   hands_won  matches_won  chips/hand\n");
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        printf("%-4u  %-12s  %-6s  %9" PRIu64 "  %11" PRIu64 "  %+10.2f\n",
+               i,
+               personality_names[ai_players[i].personality],
+               difficulty_names[ai_players[i].difficulty],
+               stats[i].hands_won,
+               stats[i].matches_won,
+               hands ? (double)stats[i].chips_won / hands : 0.0);
+    }
+
+#ifdef HOLDEM_PROFILE
+    char report[1024];
+    profile_report(report, sizeof(report));
+    printf("\n%s", report);
+#endif
+
+    return 0;
+}
\ No newline at end of file
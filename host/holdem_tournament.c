@@ -0,0 +1,373 @@
+// holdem-tournament: plays many independent AI-vs-AI matches in parallel.
+//
+// A match is played from fresh stacks until one bot has all the chips (or a
+// hand limit is hit). Matches are independent jobs: match m gets its own
+// seed derived from (seed, m) and rotates the lineup by m seats, so results
+// do not depend on the number of threads or on scheduling, and every bot
+// plays every seat equally often.
+//
+// Workers take jobs from a work-stealing pool: each owns a range of match
+// indices, and a worker that runs dry steals the upper half of another's
+// remaining range. Every worker keeps its own GameState and statistics; they
+// are only merged after all threads have joined.
+//
+// With -T (tracing build) every worker's hands go into one Chrome trace.
+
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "poker.h"
+#include "engine.h"
+#include "ai.h"
+#include "platform.h"
+#include "rng.h"
+#include "strategy.h"
+#include "trace.h"
+
+#define TOURNAMENT_MAX_THREADS 256
+
+// Per lineup entry (bot), summed over the matches a worker played
+typedef struct {
+    uint64_t matches_won;
+    uint64_t hands_won;
+    int64_t chips_won;
+} EntryStats;
+
+typedef struct {
+    uint64_t matches;
+    uint64_t unfinished; // Hit the hand limit
+    uint64_t hands;
+    EntryStats entries[MAX_PLAYERS];
+} TournamentStats;
+
+// Remaining match indices [next, end) packed into one word, so the owner
+// (advancing next) and thieves (lowering end) agree through a single CAS
+typedef struct {
+    _Atomic uint64_t range;
+    char pad[64 - sizeof(uint64_t)]; // One cache line per worker
+} WorkRange;
+
+typedef struct {
+    uint16_t index;
+    uint16_t thread_count;
+    WorkRange* ranges;
+    uint64_t seed;
+    uint32_t max_hands;
+    uint32_t trace_every;
+    const bool* hard_entries;
+    const bool* strategy_entries;
+    TournamentStats stats; // Written once per match, see tournament_play_match
+} TournamentWorker;
+
+static const char* personality_names[] = {"conservative", "aggressive", "random", "strategy"};
+static const char* difficulty_names[] = {"easy", "medium", "hard"};
+
+static uint64_t range_pack(uint32_t next, uint32_t end) {
+    return ((uint64_t)end << 32) | next;
+}
+
+// Owner side: take the next match of our own range
+static bool tournament_take(WorkRange* range, uint32_t* match) {
+    uint64_t current = atomic_load(&range->range);
+    while(true) {
+        uint32_t next = (uint32_t)current;
+        uint32_t end = (uint32_t)(current >> 32);
+        if(next >= end) return false;
+        if(atomic_compare_exchange_weak(&range->range, &current, range_pack(next + 1, end))) {
+            *match = next;
+            return true;
+        }
+    }
+}
+
+// Thief side: move the upper half of a victim's range into our empty range
+static bool tournament_steal(TournamentWorker* worker) {
+    for(uint16_t i = 1; i < worker->thread_count; i++) {
+        WorkRange* victim = &worker->ranges[(worker->index + i) % worker->thread_count];
+        uint64_t current = atomic_load(&victim->range);
+        while(true) {
+            uint32_t next = (uint32_t)current;
+            uint32_t end = (uint32_t)(current >> 32);
+            if(next >= end) break;
+            uint32_t middle = next + (end - next) / 2;
+            if(atomic_compare_exchange_weak(&victim->range, &current, range_pack(next, middle))) {
+                atomic_store(&worker->ranges[worker->index].range, range_pack(middle, end));
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void tournament_add_stats(TournamentStats* total, const TournamentStats* stats) {
+    total->matches += stats->matches;
+    total->unfinished += stats->unfinished;
+    total->hands += stats->hands;
+    for(uint8_t e = 0; e < MAX_PLAYERS; e++) {
+        total->entries[e].matches_won += stats->entries[e].matches_won;
+        total->entries[e].hands_won += stats->entries[e].hands_won;
+        total->entries[e].chips_won += stats->entries[e].chips_won;
+    }
+}
+
+// The lineup is ai_init_players' three bots plus a copy of the balanced one,
+// as in holdem-sim
+static void tournament_lineup(AIPlayer* lineup, const bool* hard_entries, const bool* strategy_entries) {
+    ai_init_players(&lineup[1]);
+    lineup[0] = lineup[MAX_PLAYERS - 1];
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        if(hard_entries[i]) lineup[i].difficulty = AI_HARD;
+        if(strategy_entries[i]) lineup[i].personality = AI_STRATEGY;
+    }
+}
+
+static void tournament_play_match(TournamentWorker* worker, uint32_t match) {
+    GameState game;
+    AIPlayer lineup[MAX_PLAYERS];
+    AIPlayer seats[MAX_PLAYERS];
+    uint8_t seat_entry[MAX_PLAYERS];
+    // Counted locally and added to worker->stats once at the end: workers
+    // share a calloc'd array, so per-hand writes there would false-share
+    TournamentStats local = {0};
+    TournamentStats* stats = &local;
+
+    // Independent deals per match: a seed of its own from (seed, match)
+    Rng match_rng;
+    rng_seed(&match_rng, worker->seed, match);
+    uint64_t match_seed = (uint64_t)rng_next(&match_rng) << 32;
+    match_seed |= rng_next(&match_rng);
+    engine_init(&game, match_seed);
+
+    tournament_lineup(lineup, worker->hard_entries, worker->strategy_entries);
+    for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+        seat_entry[seat] = (seat + match) % MAX_PLAYERS;
+        seats[seat] = lineup[seat_entry[seat]];
+    }
+
+    uint32_t hands = 0;
+    while(engine_players_with_chips(&game) >= 2 && hands < worker->max_hands) {
+        uint32_t chips_before[MAX_PLAYERS];
+        for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+            chips_before[seat] = game.players[seat].chips;
+        }
+
+        TRACE_SAMPLE(hands % worker->trace_every == 0);
+        engine_new_hand(&game);
+        TRACE_STREET(PHASE_SHOWDOWN, game.phase);
+        while(game.phase != PHASE_SHOWDOWN) {
+            uint8_t seat = game.current_player;
+            GamePhase phase = game.phase;
+            Action action = engine_apply_action(&game, ai_decide(&game, seat, &seats[seat]));
+            TRACE_STREET(phase, game.phase);
+            for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+                ai_update_opponent_model(&seats[i], seat, action.type);
+            }
+        }
+
+        ShowdownResult result;
+        uint8_t winner_count = engine_showdown(&game, &result);
+        for(uint8_t i = 0; i < winner_count; i++) {
+            stats->entries[seat_entry[result.winners[i]]].hands_won++;
+        }
+        for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+            stats->entries[seat_entry[seat]].chips_won +=
+                (int64_t)game.players[seat].chips - chips_before[seat];
+        }
+        hands++;
+    }
+
+    stats->matches++;
+    stats->hands += hands;
+    if(engine_players_with_chips(&game) >= 2) {
+        stats->unfinished++;
+    } else {
+        for(uint8_t seat = 0; seat < MAX_PLAYERS; seat++) {
+            if(game.players[seat].chips > 0) {
+                stats->entries[seat_entry[seat]].matches_won++;
+            }
+        }
+    }
+    tournament_add_stats(&worker->stats, stats);
+}
+
+static void* tournament_thread(void* ctx) {
+    TournamentWorker* worker = (TournamentWorker*)ctx;
+    uint32_t match;
+
+#ifdef HOLDEM_TRACE
+    char name[16];
+    snprintf(name, sizeof(name), "worker %u", worker->index);
+    TRACE_THREAD_NAME(name);
+#endif
+
+    while(true) {
+        if(tournament_take(&worker->ranges[worker->index], &match)) {
+            tournament_play_match(worker, match);
+        } else if(!tournament_steal(worker)) {
+            // Every range is empty; matches still in flight finish elsewhere
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void tournament_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-m matches] [-s seed] [-j threads] [-l hands] [-H entry] [-P entry [-B dir]] [-T file [-k n]]\n"
+            "  -m n      matches to play (default 10000)\n"
+            "  -s seed   random seed (default 1)\n"
+            "  -j n      worker threads (default one per core)\n"
+            "  -l n      hand limit per match (default 5000)\n"
+            "  -H entry  make a lineup entry (0-3) play as AI_HARD, may repeat\n"
+            "  -P entry  make a lineup entry play the trained strategy table, may repeat\n"
+            "  -B dir    strategy card buckets from holdem-buckets tables (as trained)\n"
+            "  -T file   write a Chrome trace of the run (make TRACE=1 builds)\n"
+            "  -k n      trace only every n-th hand of a match (default 1)\n",
+            argv0);
+}
+
+int main(int argc, char** argv) {
+    uint32_t matches = 10000;
+    uint64_t seed = 1;
+    uint32_t threads = 0;
+    uint32_t max_hands = 5000;
+    bool hard_entries[MAX_PLAYERS] = {false};
+    bool strategy_entries[MAX_PLAYERS] = {false};
+    const char* buckets_dir = NULL;
+    const char* trace_path = NULL;
+    uint32_t trace_every = 1;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-m") && i + 1 < argc) {
+            matches = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-s") && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-j") && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-l") && i + 1 < argc) {
+            max_hands = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-H") && i + 1 < argc) {
+            unsigned entry = (unsigned)strtoul(argv[++i], NULL, 10);
+            if(entry < MAX_PLAYERS) hard_entries[entry] = true;
+        } else if(!strcmp(argv[i], "-P") && i + 1 < argc) {
+            unsigned entry = (unsigned)strtoul(argv[++i], NULL, 10);
+            if(entry < MAX_PLAYERS) strategy_entries[entry] = true;
+        } else if(!strcmp(argv[i], "-B") && i + 1 < argc) {
+            buckets_dir = argv[++i];
+        } else if(!strcmp(argv[i], "-T") && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if(!strcmp(argv[i], "-k") && i + 1 < argc) {
+            trace_every = (uint32_t)strtoul(argv[++i], NULL, 10);
+            if(trace_every == 0) trace_every = 1;
+        } else {
+            tournament_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if(trace_path) {
+#ifdef HOLDEM_TRACE
+        if(!trace_open(trace_path)) {
+            perror(trace_path);
+            return 1;
+        }
+#else
+        fprintf(stderr, "-T needs a tracing build (make -C host TRACE=1)\n");
+        return 1;
+#endif
+    }
+
+    BucketTable tables[BUCKETS_STREETS];
+    if(buckets_dir) {
+        if(!buckets_map_streets(tables, buckets_dir)) {
+            fprintf(stderr, "%s: no holdem-buckets tables\n", buckets_dir);
+            return 1;
+        }
+        strategy_set_buckets(tables);
+    }
+
+    if(threads == 0) threads = platform_cpu_count();
+    if(threads > TOURNAMENT_MAX_THREADS) threads = TOURNAMENT_MAX_THREADS;
+    if(threads > matches && matches > 0) threads = matches;
+
+    WorkRange* ranges = aligned_alloc(64, sizeof(WorkRange) * threads);
+    TournamentWorker* workers = calloc(threads, sizeof(TournamentWorker));
+    pthread_t* handles = calloc(threads, sizeof(pthread_t));
+
+    // Initial split: equal contiguous ranges, stealing evens out the rest
+    poker_eval_init();
+    for(uint32_t i = 0; i < threads; i++) {
+        uint32_t begin = (uint32_t)((uint64_t)matches * i / threads);
+        uint32_t end = (uint32_t)((uint64_t)matches * (i + 1) / threads);
+        atomic_init(&ranges[i].range, range_pack(begin, end));
+        workers[i].index = (uint16_t)i;
+        workers[i].thread_count = (uint16_t)threads;
+        workers[i].ranges = ranges;
+        workers[i].seed = seed;
+        workers[i].max_hands = max_hands;
+        workers[i].trace_every = trace_every;
+        workers[i].hard_entries = hard_entries;
+        workers[i].strategy_entries = strategy_entries;
+    }
+
+    uint64_t start = platform_time_us();
+    for(uint32_t i = 0; i < threads; i++) {
+        pthread_create(&handles[i], NULL, tournament_thread, &workers[i]);
+    }
+    for(uint32_t i = 0; i < threads; i++) {
+        pthread_join(handles[i], NULL);
+    }
+    double elapsed = (platform_time_us() - start) * 1e-6;
+
+#ifdef HOLDEM_TRACE
+    if(trace_path) {
+        TraceStats trace_stats;
+        if(!trace_close(&trace_stats)) {
+            fprintf(stderr, "%s: write failed\n", trace_path);
+            return 1;
+        }
+        printf("trace:      %" PRIu64 " events from %u threads, %" PRIu64 " dropped\n",
+               trace_stats.events, trace_stats.threads, trace_stats.dropped);
+    }
+#endif
+
+    TournamentStats total = {0};
+    for(uint32_t i = 0; i < threads; i++) {
+        tournament_add_stats(&total, &workers[i].stats);
+    }
+
+    AIPlayer lineup[MAX_PLAYERS];
+    tournament_lineup(lineup, hard_entries, strategy_entries);
+
+    printf("matches:    %" PRIu64 " (%" PRIu64 " hit the hand limit)\n", total.matches, total.unfinished);
+    printf("hands:      %" PRIu64 "\n", total.hands);
+    printf("threads:    %u\n", threads);
+    printf("seconds:    %.3f\n", elapsed);
+    printf("hands/sec:  %.0f\n", elapsed > 0 ? total.hands / elapsed : 0.0);
+    printf("\nentry  personality   level   match_win_rate      hands_won  chips/hand\n");
+    for(uint8_t e = 0; e < MAX_PLAYERS; e++) {
+        // Normal approximation of the binomial 95% interval
+        double n = (double)total.matches;
+        double p = n > 0 ? total.entries[e].matches_won / n : 0.0;
+        double ci95 = n > 0 ? 1.96 * sqrt(p * (1.0 - p) / n) : 0.0;
+        printf("%-5u  %-12s  %-6s  %.4f +/- %.4f  %9" PRIu64 "  %+10.3f\n",
+               e,
+               personality_names[lineup[e].personality],
+               difficulty_names[lineup[e].difficulty],
+               p,
+               ci95,
+               total.entries[e].hands_won,
+               total.hands ? (double)total.entries[e].chips_won / total.hands : 0.0);
+    }
+
+    free(handles);
+    free(workers);
+    free(ranges);
+    return 0;
+}
\ No newline at end of file
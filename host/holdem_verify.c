@@ -0,0 +1,318 @@
+// holdem-verify: proves the hand evaluator correct by exhaustive enumeration.
+//
+// 1. Every 5-card hand (C(52,5) = 2,598,960) is ranked by a deliberately
+//    simple reference written here (rank counts, flush and straight checks)
+//    and the evaluator must order all of them the same way: equal strength
+//    exactly when the reference says the hands tie, 7462 classes in all.
+// 2. Every 7-card hand (C(52,7) = 133,784,560) is evaluated with
+//    poker_evaluate_hand; the category histogram must match the published
+//    counts, and each hand is cross-checked against a second evaluator
+//    (-e, see verify_evaluators; add a new evaluator there to validate it).
+//
+// The 7-card pass is split over all cores by first card.
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "poker.h"
+#include "platform.h"
+
+#define VERIFY_MAX_THREADS 256
+#define VERIFY_CATEGORIES (HAND_ROYAL_FLUSH + 1)
+#define VERIFY_SEVEN_CARD_HANDS 133784560ULL
+
+typedef uint16_t (*VerifyEvaluatorFunction)(CardSet cards);
+
+typedef struct {
+    const char* name;
+    VerifyEvaluatorFunction evaluate;
+} VerifyEvaluator;
+
+typedef struct {
+    const VerifyEvaluator* candidate;
+    _Atomic uint32_t* next_first_card;
+
+    uint64_t hands;
+    uint64_t categories[VERIFY_CATEGORIES];
+    uint64_t mismatches;
+    CardSet first_mismatch;
+} VerifyWorker;
+
+// Published 7-card category counts, HAND_HIGH_CARD ... HAND_ROYAL_FLUSH
+static const uint64_t verify_seven_card_counts[VERIFY_CATEGORIES] = {
+    23294460, 58627800, 31433400, 6461620, 6180020, 4047644, 3473184, 224848, 37260, 4324};
+
+static const char* category_names[VERIFY_CATEGORIES] = {
+    "high card", "pair", "two pair", "three of a kind", "straight",
+    "flush", "full house", "four of a kind", "straight flush", "royal flush"};
+
+// Best 5-card subset, strength by strength: independent of the 7-card
+// code paths (flush/straight tables over 7 bits, pair extraction), slow
+static uint16_t verify_best_of_21(CardSet cards) {
+    Card all[7];
+    uint8_t count = 0;
+    for(CardSet rest = cards; rest; rest &= rest - 1) {
+        all[count++] = (Card)__builtin_ctzll(rest);
+    }
+
+    uint16_t best = 0;
+    for(uint8_t i = 0; i < count; i++) {
+        for(uint8_t j = i + 1; j < count; j++) {
+            CardSet five = cards & ~poker_card_bit(all[i]) & ~poker_card_bit(all[j]);
+            uint16_t strength = poker_hand_rank_u16(five);
+            if(strength > best) best = strength;
+        }
+    }
+    return best;
+}
+
+static uint16_t verify_rank_u16(CardSet cards) {
+    return poker_hand_rank_u16(cards);
+}
+
+// The first entry is the default. rank_u16 runs the same code as
+// poker_evaluate_hand, so it can only catch a broken wrapper, not a wrong
+// table.
+static const VerifyEvaluator verify_evaluators[] = {
+    {"best_of_21", verify_best_of_21}, // Reference built on 5-card evaluations
+    {"rank_u16", verify_rank_u16}, // Set entry point, same tables as poker_evaluate_hand
+};
+
+// Reference 5-card ranking: category in bits 20+, then the ranks that
+// break ties, most significant first, four bits each
+static uint32_t verify_reference_key(const Card* cards, HandRank* category) {
+    uint8_t rank_count[13] = {0};
+    bool flush = true;
+    for(uint8_t i = 0; i < 5; i++) {
+        rank_count[poker_card_rank(cards[i]) - RANK_2]++;
+        if(poker_card_suit(cards[i]) != poker_card_suit(cards[0])) flush = false;
+    }
+
+    // Ranks ordered by (count, rank), descending
+    uint8_t order[5];
+    uint8_t n = 0;
+    for(int8_t times = 4; times >= 1; times--) {
+        for(int8_t rank = 12; rank >= 0; rank--) {
+            if(rank_count[rank] == times) order[n++] = (uint8_t)rank;
+        }
+    }
+
+    // Straight: five distinct consecutive ranks, or the wheel
+    bool straight = false;
+    uint8_t straight_high = 0;
+    if(n == 5) {
+        if(order[0] - order[4] == 4) {
+            straight = true;
+            straight_high = order[0];
+        } else if(order[0] == 12 && order[1] == 3) {
+            straight = true;
+            straight_high = 3;
+        }
+    }
+
+    uint8_t top = rank_count[order[0]];
+    uint8_t second = n > 1 ? rank_count[order[1]] : 0;
+    if(straight && flush) {
+        *category = straight_high == 12 ? HAND_ROYAL_FLUSH : HAND_STRAIGHT_FLUSH;
+    } else if(top == 4) {
+        *category = HAND_FOUR_KIND;
+    } else if(top == 3 && second == 2) {
+        *category = HAND_FULL_HOUSE;
+    } else if(flush) {
+        *category = HAND_FLUSH;
+    } else if(straight) {
+        *category = HAND_STRAIGHT;
+    } else if(top == 3) {
+        *category = HAND_THREE_KIND;
+    } else if(top == 2 && second == 2) {
+        *category = HAND_TWO_PAIR;
+    } else if(top == 2) {
+        *category = HAND_PAIR;
+    } else {
+        *category = HAND_HIGH_CARD;
+    }
+
+    // Royal flushes rank with straight flushes, ace high
+    uint32_t key = (uint32_t)(*category == HAND_ROYAL_FLUSH ? HAND_STRAIGHT_FLUSH : *category) << 20;
+    if(straight) return key | straight_high;
+    for(uint8_t i = 0; i < n; i++) {
+        key |= (uint32_t)order[i] << (16 - 4 * i);
+    }
+    return key;
+}
+
+// Returns the number of disagreements with the reference
+static uint64_t verify_five_cards(void) {
+    static uint32_t key_of_strength[HAND_STRENGTH_MAX + 1];
+    uint64_t errors = 0, hands = 0;
+    Card cards[5];
+
+    memset(key_of_strength, 0, sizeof(key_of_strength));
+    for(cards[0] = 0; cards[0] < DECK_SIZE; cards[0]++)
+    for(cards[1] = cards[0] + 1; cards[1] < DECK_SIZE; cards[1]++)
+    for(cards[2] = cards[1] + 1; cards[2] < DECK_SIZE; cards[2]++)
+    for(cards[3] = cards[2] + 1; cards[3] < DECK_SIZE; cards[3]++)
+    for(cards[4] = cards[3] + 1; cards[4] < DECK_SIZE; cards[4]++) {
+        HandRank category;
+        uint32_t key = verify_reference_key(cards, &category);
+        HandResult result = poker_evaluate_hand(cards, cards + HAND_SIZE, 3);
+        hands++;
+
+        // Same category, and one reference key per strength
+        if(result.rank != category || result.strength == 0 || result.strength > HAND_STRENGTH_MAX ||
+           (key_of_strength[result.strength] && key_of_strength[result.strength] != key)) {
+            if(errors++ == 0) {
+                fprintf(stderr, "5-card mismatch: cards %u %u %u %u %u strength %u\n",
+                        cards[0], cards[1], cards[2], cards[3], cards[4], result.strength);
+            }
+            continue;
+        }
+        key_of_strength[result.strength] = key;
+    }
+
+    // Every class is used and a higher strength is a higher reference key
+    uint32_t classes = 0;
+    for(uint16_t strength = 1; strength <= HAND_STRENGTH_MAX; strength++) {
+        if(!key_of_strength[strength]) continue;
+        classes++;
+        if(strength > 1 && key_of_strength[strength - 1] >= key_of_strength[strength]) errors++;
+    }
+
+    printf("5-card:  %" PRIu64 " hands, %u classes (expected 7462), ordering %s\n",
+           hands, classes, errors ? "WRONG" : "matches the reference");
+    return errors + (classes != HAND_STRENGTH_MAX);
+}
+
+static void* verify_thread(void* ctx) {
+    VerifyWorker* worker = (VerifyWorker*)ctx;
+    Card cards[7];
+    uint32_t first;
+
+    // First cards are handed out one at a time: low first cards carry far
+    // more hands, so a static split would leave threads idle
+    while((first = atomic_fetch_add(worker->next_first_card, 1)) <= DECK_SIZE - 7) {
+        cards[0] = (Card)first;
+        CardSet s0 = poker_card_bit(cards[0]);
+        for(cards[1] = cards[0] + 1; cards[1] < DECK_SIZE; cards[1]++) {
+            CardSet s1 = s0 | poker_card_bit(cards[1]);
+            for(cards[2] = cards[1] + 1; cards[2] < DECK_SIZE; cards[2]++) {
+                CardSet s2 = s1 | poker_card_bit(cards[2]);
+                for(cards[3] = cards[2] + 1; cards[3] < DECK_SIZE; cards[3]++) {
+                    CardSet s3 = s2 | poker_card_bit(cards[3]);
+                    for(cards[4] = cards[3] + 1; cards[4] < DECK_SIZE; cards[4]++) {
+                        CardSet s4 = s3 | poker_card_bit(cards[4]);
+                        for(cards[5] = cards[4] + 1; cards[5] < DECK_SIZE; cards[5]++) {
+                            CardSet s5 = s4 | poker_card_bit(cards[5]);
+                            for(cards[6] = cards[5] + 1; cards[6] < DECK_SIZE; cards[6]++) {
+                                HandResult result = poker_evaluate_hand(cards, cards + HAND_SIZE, 5);
+                                worker->categories[result.rank]++;
+                                if(worker->candidate) {
+                                    CardSet set = s5 | poker_card_bit(cards[6]);
+                                    if(worker->candidate->evaluate(set) != result.strength &&
+                                       worker->mismatches++ == 0) {
+                                        worker->first_mismatch = set;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+static void verify_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-j threads] [-e evaluator|none]\n"
+            "  -j n      worker threads (default one per core)\n"
+            "  -e name   evaluator to cross-check hand by hand (default best_of_21):",
+            argv0);
+    for(size_t i = 0; i < sizeof(verify_evaluators) / sizeof(verify_evaluators[0]); i++) {
+        fprintf(stderr, " %s", verify_evaluators[i].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char** argv) {
+    uint32_t threads = 0;
+    const VerifyEvaluator* candidate = &verify_evaluators[0];
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-j") && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-e") && i + 1 < argc) {
+            const char* name = argv[++i];
+            candidate = NULL;
+            for(size_t e = 0; e < sizeof(verify_evaluators) / sizeof(verify_evaluators[0]); e++) {
+                if(!strcmp(name, verify_evaluators[e].name)) candidate = &verify_evaluators[e];
+            }
+            if(!candidate && strcmp(name, "none")) {
+                verify_usage(argv[0]);
+                return 1;
+            }
+        } else {
+            verify_usage(argv[0]);
+            return 1;
+        }
+    }
+    if(threads == 0) threads = platform_cpu_count();
+    if(threads > VERIFY_MAX_THREADS) threads = VERIFY_MAX_THREADS;
+
+    poker_eval_init();
+    uint64_t failures = verify_five_cards();
+
+    VerifyWorker* workers = calloc(threads, sizeof(VerifyWorker));
+    pthread_t* handles = calloc(threads, sizeof(pthread_t));
+    _Atomic uint32_t next_first_card;
+    atomic_init(&next_first_card, 0);
+
+    uint64_t start = platform_time_us();
+    for(uint32_t i = 0; i < threads; i++) {
+        workers[i].candidate = candidate;
+        workers[i].next_first_card = &next_first_card;
+        pthread_create(&handles[i], NULL, verify_thread, &workers[i]);
+    }
+    for(uint32_t i = 0; i < threads; i++) {
+        pthread_join(handles[i], NULL);
+    }
+    double elapsed = (platform_time_us() - start) * 1e-6;
+
+    uint64_t categories[VERIFY_CATEGORIES] = {0};
+    uint64_t hands = 0, mismatches = 0;
+    CardSet first_mismatch = 0;
+    for(uint32_t i = 0; i < threads; i++) {
+        for(uint8_t c = 0; c < VERIFY_CATEGORIES; c++) {
+            categories[c] += workers[i].categories[c];
+            hands += workers[i].categories[c];
+        }
+        if(workers[i].mismatches && !first_mismatch) first_mismatch = workers[i].first_mismatch;
+        mismatches += workers[i].mismatches;
+    }
+
+    printf("7-card:  %" PRIu64 " hands (expected %llu) on %u threads, %.2f s, %.1f M hands/sec\n",
+           hands, VERIFY_SEVEN_CARD_HANDS, threads, elapsed, elapsed > 0 ? hands / elapsed / 1e6 : 0.0);
+    failures += hands != VERIFY_SEVEN_CARD_HANDS;
+    for(uint8_t c = 0; c < VERIFY_CATEGORIES; c++) {
+        bool ok = categories[c] == verify_seven_card_counts[c];
+        printf("  %-16s %10" PRIu64 "  %s\n", category_names[c], categories[c], ok ? "ok" : "WRONG");
+        failures += !ok;
+    }
+    if(candidate) {
+        printf("cross-check against %s: %" PRIu64 " mismatches\n", candidate->name, mismatches);
+        if(mismatches) {
+            fprintf(stderr, "first mismatch: set 0x%013" PRIx64 "\n", first_mismatch);
+        }
+        failures += mismatches;
+    }
+
+    free(handles);
+    free(workers);
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+// preflop-gen: writes preflop_table.c, the preflop equity of every
+// starting-hand class against 1 to PREFLOP_MAX_OPPONENTS random hands.
+//
+// Each entry is a Monte Carlo run of the class's representative hand; with
+// the default 1000000 rollouts the 95% interval is about +/- 0.001. The
+// output is deterministic for a given seed and rollout count.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "equity.h"
+#include "preflop.h"
+
+static void gen_usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-i rollouts] [-s seed] [-o file]\n"
+            "  -i n     rollouts per class and opponent count (default 1000000)\n"
+            "  -s seed  random seed (default 1)\n"
+            "  -o file  output file (default stdout)\n",
+            argv0);
+}
+
+int main(int argc, char** argv) {
+    EquityBudget budget = {
+        .max_iterations = 1000000,
+        .seed = 1,
+        .mode = EQUITY_MONTE_CARLO,
+    };
+    const char* output_path = NULL;
+
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-i") && i + 1 < argc) {
+            budget.max_iterations = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-s") && i + 1 < argc) {
+            budget.seed = strtoull(argv[++i], NULL, 10);
+        } else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+            output_path = argv[++i];
+        } else {
+            gen_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    poker_eval_init();
+    FILE* out = output_path ? fopen(output_path, "w") : stdout;
+    if(!out) {
+        perror(output_path);
+        return 1;
+    }
+
+    uint64_t seed = budget.seed;
+    fprintf(out, "// Generated by host/preflop_gen.c (%" PRIu32 " rollouts per entry, seed %" PRIu64 "),\n",
+            budget.max_iterations, seed);
+    fprintf(out, "// do not edit. Regenerate with: make -C host preflop-table\n\n");
+    fprintf(out, "#include \"preflop.h\"\n\n");
+    fprintf(out, "const uint16_t preflop_equity_table[PREFLOP_CLASSES][PREFLOP_MAX_OPPONENTS] = {\n");
+
+    for(uint8_t hand_class = 0; hand_class < PREFLOP_CLASSES; hand_class++) {
+        char name[4];
+        preflop_class_name(hand_class, name, sizeof(name));
+        fprintf(out, "    {");
+        for(uint8_t opponents = 1; opponents <= PREFLOP_MAX_OPPONENTS; opponents++) {
+            // Every entry gets its own stream so entries can be rerun alone
+            budget.seed = seed + (uint64_t)hand_class * PREFLOP_MAX_OPPONENTS + opponents;
+            EquityResult result = equity_monte_carlo(preflop_class_hand(hand_class), 0, opponents, &budget);
+            fprintf(out, "%s%5u", opponents > 1 ? ", " : "", (unsigned)(result.equity * 65535.0f + 0.5f));
+        }
+        fprintf(out, "}, // %s\n", name);
+        fprintf(stderr, "\r%u/%u", hand_class + 1, PREFLOP_CLASSES);
+    }
+
+    fprintf(out, "};");
+    fprintf(stderr, "\n");
+    if(out != stdout) fclose(out);
+    return 0;
+}
\ No newline at end of file
@@ -3,12 +3,64 @@
 #include <input/input.h>
 #include <stdlib.h>
 #include <furi_hal.h>
+#include <storage/storage.h>
 #include <string.h>
+#include <stdatomic.h>
 
 #include "poker.h"
+#include "engine.h"
 #include "ai.h"
+#include "ai_worker.h"
+#include "spsc_ring.h"
+#include "hand_history.h"
+#include "profile.h"
 #include "ui.h"
 
+// Pacing of the table, in milliseconds
+#define GAME_AI_DELAY_MS 50
+#define GAME_NEXT_HAND_DELAY_MS 3000
+#define GAME_NOTIFICATION_MS 3000
+
+// Thread flag the event producers set to wake the app thread
+#define GAME_FLAG_EVENT (1 << 0)
+#define GAME_VIEW_NONE 0xFF
+
+// Every hand played is appended here (see hand_history.h)
+#define GAME_HISTORY_PATH APP_DATA_PATH("hands.bin")
+// Profiling report saved from the overlay (HOLDEM_PROFILE builds)
+#define GAME_PROFILE_PATH APP_DATA_PATH("profile.txt")
+
+// Everything that can happen to the game. Input, timer and AI worker
+// callbacks only queue events; the game itself runs on the app thread.
+typedef enum {
+    GameEventTypeInput,
+    GameEventTypeAiTurn, // Pause before an AI acts is over, start thinking
+    GameEventTypeAiDecision, // The AI worker has decided
+    GameEventTypeNextHand,
+    GameEventTypeNotificationTimeout,
+} GameEventType;
+
+typedef struct {
+    GameEventType type;
+    union {
+        InputEvent input; // GameEventTypeInput
+        AIDecision decision; // GameEventTypeAiDecision
+    };
+} GameEvent;
+
+// What the GUI thread draws: a copy of the table published by the app thread
+typedef struct {
+    GameState game;
+    MenuOption selected_menu;
+    bool show_menu;
+    bool show_notification;
+    char notification_text[64];
+#ifdef HOLDEM_PROFILE
+    bool show_profile;
+    ProfileSummary profile[PROFILE_PROBE_COUNT];
+#endif
+} GameView;
+
 typedef struct {
     GameState game;
     AIPlayer ai_players[MAX_PLAYERS - 1];
@@ -16,37 +68,148 @@ typedef struct {
     UIState ui_state;
     bool show_notification;
     char notification_text[64];
-    uint32_t notification_timer;
-    FuriTimer* game_timer;
     bool waiting_for_input;
+#ifdef HOLDEM_PROFILE
+    bool show_profile; // Up toggles the probe overlay, Down saves a report
+#endif
+    
+    // One single-producer ring per producing thread: GUI input, the timer
+    // service (all app timers share it) and the AI worker
+    FuriThreadId app_thread;
+    SpscRing input_ring;
+    SpscRing timer_ring;
+    SpscRing ai_ring;
+    GameEvent input_events[8];
+    GameEvent timer_events[4];
+    GameEvent ai_events[2];
+    
+    // Double-buffered view: the app thread fills the unpublished buffer and
+    // flips `view_published`; the GUI thread marks the one it is drawing
+    GameView views[2];
+    _Atomic uint8_t view_published;
+    _Atomic uint8_t view_reading;
+    bool view_valid; // A view has been published
+    
+    AIWorker* ai_worker;
+    uint32_t ai_request_id; // Request whose decision we are waiting for, 0 = none
+    // One-shot timers, armed only while something is pending
+    FuriTimer* ai_timer;
+    FuriTimer* next_hand_timer;
+    FuriTimer* notification_timer;
+    
+    // Hand history on the SD card; history_file is NULL when it could not
+    // be opened, and the game goes on without recording
+    Storage* storage;
+    File* history_file;
+    HandHistoryWriter history;
+    HandRecord hand_record;
 } TexasHoldemApp;
 
 // Forward declarations
 static void game_init(TexasHoldemApp* app);
 static void game_new_hand(TexasHoldemApp* app);
-static void game_deal_cards(TexasHoldemApp* app);
-static void game_next_phase(TexasHoldemApp* app);
 static void game_betting_round(TexasHoldemApp* app);
 static void game_showdown(TexasHoldemApp* app);
-static void game_update_pot(TexasHoldemApp* app);
-static bool game_is_betting_complete(TexasHoldemApp* app);
+static void game_apply_action(TexasHoldemApp* app, Action action);
 static void game_process_player_action(TexasHoldemApp* app, PlayerAction action);
 static void game_process_ai_turn(TexasHoldemApp* app);
-static void game_post_blinds(TexasHoldemApp* app);
+static void game_process_ai_decision(TexasHoldemApp* app, const AIDecision* decision);
+static void game_notify_player_action(TexasHoldemApp* app, PlayerAction action, uint32_t called, uint32_t bet);
+static void game_show_notification(TexasHoldemApp* app, const char* message);
 static void game_update_ai_models(TexasHoldemApp* app, uint8_t player_id, PlayerAction action);
+static void game_history_open(TexasHoldemApp* app);
+static void game_history_close(TexasHoldemApp* app);
 
+// Runs on the GUI thread. Claims the published view, re-checking that it is
+// still the published one, so the app thread never overwrites it mid-draw.
 static void render_callback(Canvas* canvas, void* ctx) {
+    PROFILE_SCOPE(PROFILE_RENDER);
     TexasHoldemApp* app = (TexasHoldemApp*)ctx;
+    uint8_t index;
     
-    ui_draw_game_screen(canvas, &app->game);
+    do {
+        index = atomic_load(&app->view_published);
+        atomic_store(&app->view_reading, index);
+    } while(atomic_load(&app->view_published) != index);
+    
+    GameView* view = &app->views[index];
+#ifdef HOLDEM_PROFILE
+    if(view->show_profile) {
+        ui_draw_profile(canvas, view->profile, PROFILE_PROBE_COUNT, profile_cycles_per_us());
+        atomic_store(&app->view_reading, GAME_VIEW_NONE);
+        return;
+    }
+#endif
+    ui_draw_game_screen(canvas, &view->game);
     
-    if(app->game.current_player == 0 && !app->game.players[0].folded && app->waiting_for_input) {
-        ui_draw_menu(canvas, app->selected_menu);
+    if(view->show_menu) {
+        ui_draw_menu(canvas, view->selected_menu);
     }
     
-    if(app->show_notification) {
-        ui_draw_notification(canvas, app->notification_text);
+    if(view->show_notification) {
+        ui_draw_notification(canvas, view->notification_text);
+    }
+    
+    atomic_store(&app->view_reading, GAME_VIEW_NONE);
+}
+
+// Runs on the app thread after each batch of events. Returns false, and
+// publishes nothing, when the view did not change (e.g. a stale AI decision
+// or a key press that did nothing), so the screen is only redrawn on changes.
+static bool game_publish_view(TexasHoldemApp* app) {
+    uint8_t front = atomic_load(&app->view_published);
+    uint8_t back = front ^ 1;
+    
+    // The GUI thread can still be drawing the back buffer if it claimed it
+    // before the last flip; that draw is short, wait it out
+    while(atomic_load(&app->view_reading) == back) {
+        furi_delay_tick(1);
+    }
+    
+    GameView* view = &app->views[back];
+    memset(view, 0, sizeof(GameView));
+    memcpy(&view->game, &app->game, sizeof(GameState));
+    view->selected_menu = app->selected_menu;
+    view->show_menu = app->game.current_player == 0 && !app->game.players[0].folded &&
+                      app->waiting_for_input;
+    view->show_notification = app->show_notification;
+    if(view->show_notification) {
+        strcpy(view->notification_text, app->notification_text);
+    }
+#ifdef HOLDEM_PROFILE
+    view->show_profile = app->show_profile;
+    if(view->show_profile) {
+        for(uint8_t i = 0; i < PROFILE_PROBE_COUNT; i++) {
+            profile_summary((ProfileProbe)i, &view->profile[i]);
+        }
+    }
+#endif
+    
+    if(app->view_valid && memcmp(view, &app->views[front], sizeof(GameView)) == 0) {
+        return false;
     }
+    
+    atomic_store(&app->view_published, back);
+    app->view_valid = true;
+    return true;
+}
+
+// Producers push and then raise the flag; the app thread drains every ring
+// after each wake-up, so an event is never left behind
+static void game_post_to(TexasHoldemApp* app, SpscRing* ring, const GameEvent* event) {
+    if(spsc_ring_push(ring, event)) {
+        furi_thread_flags_set(app->app_thread, GAME_FLAG_EVENT);
+    }
+}
+
+static bool game_next_event(TexasHoldemApp* app, GameEvent* event) {
+    return spsc_ring_pop(&app->input_ring, event) || spsc_ring_pop(&app->timer_ring, event) ||
+           spsc_ring_pop(&app->ai_ring, event);
+}
+
+static void game_post_event(TexasHoldemApp* app, GameEventType type) {
+    GameEvent event = {.type = type};
+    game_post_to(app, &app->timer_ring, &event);
 }
 
 static void input_callback(InputEvent* input_event, void* ctx) {
@@ -54,9 +217,64 @@ static void input_callback(InputEvent* input_event, void* ctx) {
     
     if(input_event->type != InputTypePress) return;
     
+    // Never block the GUI thread; a key press dropped from a full ring is harmless
+    GameEvent event = {.type = GameEventTypeInput, .input = *input_event};
+    game_post_to(app, &app->input_ring, &event);
+}
+
+static void ai_timer_callback(void* ctx) {
+    game_post_event((TexasHoldemApp*)ctx, GameEventTypeAiTurn);
+}
+
+static void next_hand_timer_callback(void* ctx) {
+    game_post_event((TexasHoldemApp*)ctx, GameEventTypeNextHand);
+}
+
+static void notification_timer_callback(void* ctx) {
+    game_post_event((TexasHoldemApp*)ctx, GameEventTypeNotificationTimeout);
+}
+
+// Runs on the AI worker thread. Only one request is in flight at a time, so
+// the ring always has room.
+static void ai_decision_callback(const AIDecision* decision, void* ctx) {
+    TexasHoldemApp* app = (TexasHoldemApp*)ctx;
+    GameEvent event = {.type = GameEventTypeAiDecision, .decision = *decision};
+    game_post_to(app, &app->ai_ring, &event);
+}
+
+#ifdef HOLDEM_PROFILE
+static void game_profile_save(TexasHoldemApp* app) {
+    char report[512];
+    size_t length = profile_report(report, sizeof(report));
+    if(length >= sizeof(report)) length = sizeof(report) - 1;
+    
+    File* file = storage_file_alloc(app->storage);
+    bool saved = storage_file_open(file, GAME_PROFILE_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                 storage_file_write(file, report, length) == length;
+    storage_file_close(file);
+    storage_file_free(file);
+    
+    app->show_profile = false;
+    game_show_notification(app, saved ? "Profile saved" : "Save failed");
+}
+#endif
+
+static void game_handle_input(TexasHoldemApp* app, InputEvent* input_event) {
+#ifdef HOLDEM_PROFILE
+    if(input_event->key == InputKeyUp) {
+        app->show_profile = !app->show_profile;
+        return;
+    }
+    if(app->show_profile) {
+        if(input_event->key == InputKeyDown) game_profile_save(app);
+        return;
+    }
+#endif
+    
     if(app->show_notification) {
         if(input_event->key == InputKeyOk) {
             app->show_notification = false;
+            furi_timer_stop(app->notification_timer);
         }
         return;
     }
@@ -100,390 +318,157 @@ static void input_callback(InputEvent* input_event, void* ctx) {
     }
 }
 
-static void timer_callback(void* ctx) {
-    TexasHoldemApp* app = (TexasHoldemApp*)ctx;
-    
-    if(app->show_notification) {
-        app->notification_timer++;
-        if(app->notification_timer > 60) { // 3 seconds at 20 FPS
+static void game_handle_event(TexasHoldemApp* app, GameEvent* event) {
+    switch(event->type) {
+        case GameEventTypeInput:
+            game_handle_input(app, &event->input);
+            break;
+        case GameEventTypeAiTurn:
+            if(!app->game.game_over && app->game.phase != PHASE_SHOWDOWN &&
+               app->game.current_player != 0) {
+                game_process_ai_turn(app);
+            }
+            break;
+        case GameEventTypeAiDecision:
+            game_process_ai_decision(app, &event->decision);
+            break;
+        case GameEventTypeNextHand:
+            if(!app->game.game_over) {
+                game_new_hand(app);
+            }
+            break;
+        case GameEventTypeNotificationTimeout:
             app->show_notification = false;
-            app->notification_timer = 0;
-        }
-    }
-    
-    // Process AI turns
-    if(app->game.current_player != 0 && !app->waiting_for_input) {
-        game_process_ai_turn(app);
+            break;
     }
 }
 
 static void game_init(TexasHoldemApp* app) {
-    // Initialize random seed
-    srand(furi_hal_random_get());
-    
-    // Initialize players
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        app->game.players[i].chips = STARTING_CHIPS;
-        app->game.players[i].bet = 0;
-        app->game.players[i].folded = false;
-        app->game.players[i].all_in = false;
-        app->game.players[i].last_action = ACTION_CHECK;
-        
-        if(i == 0) {
-            strcpy(app->game.players[i].name, "You");
-        } else {
-            snprintf(app->game.players[i].name, sizeof(app->game.players[i].name), "AI%d", i);
-        }
-    }
+    // Initialize players and table with a fresh session seed
+    uint64_t seed = ((uint64_t)furi_hal_random_get() << 32) | furi_hal_random_get();
+    engine_init(&app->game, seed);
     
     // Initialize AI players
     ai_init_players(app->ai_players);
     
-    // Initialize game state
-    app->game.community_count = 0;
-    app->game.phase = PHASE_PREFLOP;
-    app->game.current_player = 0;
-    app->game.dealer = 0;
-    app->game.pot = 0;
-    app->game.current_bet = 0;
-    app->game.active_players = MAX_PLAYERS;
-    app->game.game_over = false;
-    app->game.hand_number = 0;
-    app->game.blinds_posted = false;
-    
     // Initialize UI state
     app->selected_menu = MENU_CHECK_CALL;
     app->ui_state = UI_STATE_GAME;
     app->show_notification = false;
     app->waiting_for_input = false;
+#ifdef HOLDEM_PROFILE
+    app->show_profile = false;
+#endif
     
     game_new_hand(app);
 }
 
 static void game_new_hand(TexasHoldemApp* app) {
-    // Reset for new hand
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        app->game.players[i].bet = 0;
-        app->game.players[i].folded = false;
-        app->game.players[i].all_in = false;
-        app->game.players[i].last_action = ACTION_CHECK;
-    }
-    
-    app->game.community_count = 0;
-    app->game.phase = PHASE_PREFLOP;
-    app->game.pot = 0;
-    app->game.current_bet = 0;
-    app->game.active_players = MAX_PLAYERS;
-    app->game.hand_number++;
-    app->game.blinds_posted = false;
-    
-    // Move dealer button
-    app->game.dealer = (app->game.dealer + 1) % MAX_PLAYERS;
-    
-    // Set blind positions
-    app->game.small_blind_pos = (app->game.dealer + 1) % MAX_PLAYERS;
-    app->game.big_blind_pos = (app->game.dealer + 2) % MAX_PLAYERS;
-    
-    // Initialize and shuffle deck
-    poker_init_deck(&app->game.deck);
-    poker_shuffle_deck(&app->game.deck);
-    
-    // Deal hole cards
-    game_deal_cards(app);
-    
-    // Post blinds
-    game_post_blinds(app);
-    
-    // Start betting round with player after big blind
-    app->game.current_player = (app->game.big_blind_pos + 1) % MAX_PLAYERS;
-    
-    // Start betting round
+    // Shuffle, deal, post blinds and find the first player to act
+    engine_new_hand(&app->game);
+    hand_history_begin(&app->hand_record, &app->game);
     game_betting_round(app);
 }
 
-static void game_deal_cards(TexasHoldemApp* app) {
-    // Deal two hole cards to each player
-    for(uint8_t i = 0; i < HAND_SIZE; i++) {
-        for(uint8_t j = 0; j < MAX_PLAYERS; j++) {
-            app->game.players[j].hand[i] = poker_deal_card(&app->game.deck);
-        }
-    }
-}
-
 static void game_betting_round(TexasHoldemApp* app) {
+    // The hand may have ended on the last action (fold-out or river closed)
+    if(app->game.phase == PHASE_SHOWDOWN) {
+        app->waiting_for_input = false;
+        game_showdown(app);
+        return;
+    }
+    
     if(app->game.current_player == 0) {
         app->waiting_for_input = true;
     } else {
+        // Give the AI its turn after a short pause so the table is readable
         app->waiting_for_input = false;
+        furi_timer_start(app->ai_timer, furi_ms_to_ticks(GAME_AI_DELAY_MS));
     }
 }
 
-static void game_process_player_action(TexasHoldemApp* app, PlayerAction action) {
-    Player* player = &app->game.players[app->game.current_player];
-    
-    switch(action) {
-        case ACTION_FOLD:
-            player->folded = true;
-            player->last_action = ACTION_FOLD;
-            app->game.active_players--;
-            game_show_notification(app, "You folded");
-            break;
-            
-        case ACTION_CHECK:
-            player->last_action = ACTION_CHECK;
-            game_show_notification(app, "You checked");
-            break;
-            
-        case ACTION_CALL:
-            {
-                uint32_t call_amount = app->game.current_bet - player->bet;
-                if(call_amount >= player->chips) {
-                    // All-in
-                    call_amount = player->chips;
-                    player->all_in = true;
-                }
-                player->bet += call_amount;
-                player->chips -= call_amount;
-                player->last_action = ACTION_CALL;
-                
-                char msg[32];
-                snprintf(msg, sizeof(msg), "You called $%lu", call_amount);
-                game_show_notification(app, msg);
-            }
-            break;
-            
-        case ACTION_RAISE:
-            {
-                uint32_t min_raise = app->game.current_bet * 2;
-                if(min_raise == 0) min_raise = BIG_BLIND; // Minimum bet if no current bet
-                
-                uint32_t raise_amount = min_raise;
-                if(raise_amount > player->chips) {
-                    raise_amount = player->chips;
-                    player->all_in = true;
-                }
-                
-                uint32_t total_bet = raise_amount;
-                player->chips -= (total_bet - player->bet);
-                player->bet = total_bet;
-                app->game.current_bet = total_bet;
-                player->last_action = ACTION_RAISE;
-                
-                char msg[32];
-                snprintf(msg, sizeof(msg), "You raised to $%lu", total_bet);
-                game_show_notification(app, msg);
-            }
-            break;
-    }
-    
-    // Update AI models with human player's action
-    game_update_ai_models(app, app->game.current_player, action);
-    
-    // Move to next player
-    do {
-        app->game.current_player = (app->game.current_player + 1) % MAX_PLAYERS;
-    } while(app->game.players[app->game.current_player].folded || 
-            app->game.players[app->game.current_player].all_in);
-    
-    // Check if betting round is complete
-    if(game_is_betting_complete(app)) {
-        game_update_pot(app);
-        
-        if(app->game.active_players <= 1) {
-            // Only one player left, they win
-            game_showdown(app);
-        } else {
-            game_next_phase(app);
-        }
-    } else {
-        game_betting_round(app);
-    }
+// Every action, human or AI, goes through here: the engine applies it, the
+// human gets a notification for their own action and the AI models see it
+static void game_apply_action(TexasHoldemApp* app, Action action) {
+    uint8_t player_index = app->game.current_player;
+    Player* player = &app->game.players[player_index];
+    uint32_t bet_before = player->bet;
+    GamePhase phase = app->game.phase;
     
     app->waiting_for_input = false;
-}
-
-static void game_process_ai_turn(TexasHoldemApp* app) {
-    uint8_t ai_index = app->game.current_player - 1;
-    Player* player = &app->game.players[app->game.current_player];
-    
-    PlayerAction action = ai_decide_action(&app->game, app->game.current_player, &app->ai_players[ai_index]);
+    action = engine_apply_action(&app->game, action);
+    hand_history_add_action(&app->hand_record, phase, player_index, action);
     
-    switch(action) {
-        case ACTION_FOLD:
-            player->folded = true;
-            player->last_action = ACTION_FOLD;
-            app->game.active_players--;
-            break;
-            
-        case ACTION_CHECK:
-            player->last_action = ACTION_CHECK;
-            break;
-            
-        case ACTION_CALL:
-            {
-                uint32_t call_amount = app->game.current_bet - player->bet;
-                if(call_amount >= player->chips) {
-                    call_amount = player->chips;
-                    player->all_in = true;
-                }
-                player->bet += call_amount;
-                player->chips -= call_amount;
-                player->last_action = ACTION_CALL;
-            }
-            break;
-            
-        case ACTION_RAISE:
-            {
-                uint32_t raise_amount = ai_decide_raise_amount(&app->game, app->game.current_player, &app->ai_players[ai_index]);
-                if(raise_amount > player->chips) {
-                    raise_amount = player->chips;
-                    player->all_in = true;
-                }
-                
-                player->chips -= (raise_amount - player->bet);
-                player->bet = raise_amount;
-                app->game.current_bet = raise_amount;
-                player->last_action = ACTION_RAISE;
-            }
-            break;
+    if(player_index == 0) {
+        game_notify_player_action(app, action.type, player->bet - bet_before, player->bet);
     }
     
     // Update AI models with this player's action
-    game_update_ai_models(app, app->game.current_player, action);
+    game_update_ai_models(app, player_index, action.type);
     
-    // Move to next player
-    do {
-        app->game.current_player = (app->game.current_player + 1) % MAX_PLAYERS;
-    } while(app->game.players[app->game.current_player].folded || 
-            app->game.players[app->game.current_player].all_in);
-    
-    // Check if betting round is complete
-    if(game_is_betting_complete(app)) {
-        game_update_pot(app);
-        
-        if(app->game.active_players <= 1) {
-            game_showdown(app);
-        } else {
-            game_next_phase(app);
-        }
-    } else {
-        game_betting_round(app);
-    }
+    game_betting_round(app);
 }
 
-static bool game_is_betting_complete(TexasHoldemApp* app) {
-    uint32_t max_bet = 0;
-    uint8_t players_to_act = 0;
-    
-    // Find maximum bet
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        if(!app->game.players[i].folded && app->game.players[i].bet > max_bet) {
-            max_bet = app->game.players[i].bet;
-        }
-    }
-    
-    // Count players who haven't matched the max bet and can still act
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        Player* player = &app->game.players[i];
-        if(!player->folded && !player->all_in && player->bet < max_bet) {
-            players_to_act++;
-        }
-    }
+static void game_process_player_action(TexasHoldemApp* app, PlayerAction action) {
+    game_apply_action(app, (Action){action, engine_min_raise_to(&app->game)});
+}
+
+// Hand the decision to the worker thread; the app keeps handling input and
+// redrawing until GameEventTypeAiDecision comes back
+static void game_process_ai_turn(TexasHoldemApp* app) {
+    uint8_t player_index = app->game.current_player;
     
-    return players_to_act == 0;
+    app->ai_request_id =
+        ai_worker_request(app->ai_worker, &app->game, player_index, &app->ai_players[player_index - 1]);
 }
 
-static void game_update_pot(TexasHoldemApp* app) {
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        app->game.pot += app->game.players[i].bet;
-        app->game.players[i].bet = 0;
+static void game_process_ai_decision(TexasHoldemApp* app, const AIDecision* decision) {
+    // Ignore decisions for a position that is no longer current
+    if(decision->request_id != app->ai_request_id || app->game.game_over ||
+       app->game.phase == PHASE_SHOWDOWN || app->game.current_player != decision->seat) {
+        return;
     }
-    app->game.current_bet = 0;
+    app->ai_request_id = 0;
+    
+    // Keep what the AI learned while thinking (cache, random stream position)
+    app->ai_players[decision->seat - 1] = decision->ai_player;
+    app->game.rng = decision->rng;
+    
+    game_apply_action(app, decision->action);
 }
 
-static void game_next_phase(TexasHoldemApp* app) {
-    switch(app->game.phase) {
-        case PHASE_PREFLOP:
-            // Deal flop (3 cards)
-            for(uint8_t i = 0; i < 3; i++) {
-                app->game.community[i] = poker_deal_card(&app->game.deck);
-            }
-            app->game.community_count = 3;
-            app->game.phase = PHASE_FLOP;
+static void game_notify_player_action(TexasHoldemApp* app, PlayerAction action, uint32_t called, uint32_t bet) {
+    char msg[32];
+    switch(action) {
+        case ACTION_FOLD:
+            game_show_notification(app, "You folded");
             break;
             
-        case PHASE_FLOP:
-            // Deal turn (1 card)
-            app->game.community[3] = poker_deal_card(&app->game.deck);
-            app->game.community_count = 4;
-            app->game.phase = PHASE_TURN;
+        case ACTION_CHECK:
+            game_show_notification(app, "You checked");
             break;
             
-        case PHASE_TURN:
-            // Deal river (1 card)
-            app->game.community[4] = poker_deal_card(&app->game.deck);
-            app->game.community_count = 5;
-            app->game.phase = PHASE_RIVER;
+        case ACTION_CALL:
+            snprintf(msg, sizeof(msg), "You called $%lu", called);
+            game_show_notification(app, msg);
             break;
             
-        case PHASE_RIVER:
-            // Go to showdown
-            game_showdown(app);
-            return;
-            
-        case PHASE_SHOWDOWN:
-            // Start new hand
-            game_new_hand(app);
-            return;
-    }
-    
-    // Reset for new betting round - start with player after dealer
-    app->game.current_player = (app->game.dealer + 1) % MAX_PLAYERS;
-    while(app->game.players[app->game.current_player].folded || 
-          app->game.players[app->game.current_player].all_in) {
-        app->game.current_player = (app->game.current_player + 1) % MAX_PLAYERS;
+        case ACTION_RAISE:
+            snprintf(msg, sizeof(msg), "You raised to $%lu", bet);
+            game_show_notification(app, msg);
+            break;
     }
-    
-    game_betting_round(app);
 }
 
 static void game_showdown(TexasHoldemApp* app) {
-    app->game.phase = PHASE_SHOWDOWN;
-    
-    HandResult best_hands[MAX_PLAYERS];
-    uint8_t winners[MAX_PLAYERS];
-    uint8_t winner_count = 0;
-    
-    // Evaluate all non-folded hands
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        if(!app->game.players[i].folded) {
-            best_hands[i] = poker_evaluate_hand(app->game.players[i].hand, app->game.community, app->game.community_count);
-        }
-    }
-    
-    // Find winner(s)
-    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
-        if(app->game.players[i].folded) continue;
-        
-        bool is_winner = true;
-        for(uint8_t j = 0; j < MAX_PLAYERS; j++) {
-            if(i == j || app->game.players[j].folded) continue;
-            
-            if(poker_compare_hands(&best_hands[i], &best_hands[j]) < 0) {
-                is_winner = false;
-                break;
-            }
-        }
-        
-        if(is_winner) {
-            winners[winner_count++] = i;
-        }
-    }
-    
-    // Distribute pot
-    uint32_t share = app->game.pot / winner_count;
-    for(uint8_t i = 0; i < winner_count; i++) {
-        app->game.players[winners[i]].chips += share;
+    ShowdownResult result;
+    uint8_t winner_count = engine_showdown(&app->game, &result);
+    const uint8_t* winners = result.winners;
+    uint32_t share = result.won[winners[0]];
+    
+    if(app->history_file) {
+        hand_history_finish(&app->hand_record, &app->game, result.pot, winners, winner_count);
+        hand_history_append(&app->history, &app->hand_record);
     }
     
     // Show result
@@ -492,51 +477,30 @@ static void game_showdown(TexasHoldemApp* app) {
         if(winners[0] == 0) {
             snprintf(msg, sizeof(msg), "You won $%lu!", share);
         } else {
-            snprintf(msg, sizeof(msg), "%s won $%lu", app->game.players[winners[0]].name, share);
+            snprintf(msg, sizeof(msg), "%s won $%lu", ui_player_name(winners[0]), share);
         }
         game_show_notification(app, msg);
     } else {
         game_show_notification(app, "Split pot!");
     }
     
-    app->game.pot = 0;
-    
     // Check for game over
     if(app->game.players[0].chips == 0) {
         game_show_notification(app, "Game Over!");
         app->game.game_over = true;
+    } else if(engine_players_with_chips(&app->game) < 2) {
+        game_show_notification(app, "You win the table!");
+        app->game.game_over = true;
     } else {
-        // Start new hand after delay
-        furi_delay_ms(3000);
-        game_new_hand(app);
+        // Leave the result on screen, then deal the next hand
+        furi_timer_start(app->next_hand_timer, furi_ms_to_ticks(GAME_NEXT_HAND_DELAY_MS));
     }
 }
 
 static void game_show_notification(TexasHoldemApp* app, const char* message) {
     strcpy(app->notification_text, message);
     app->show_notification = true;
-    app->notification_timer = 0;
-}
-
-static void game_post_blinds(TexasHoldemApp* app) {
-    if(app->game.blinds_posted) return;
-    
-    // Post small blind
-    Player* small_blind = &app->game.players[app->game.small_blind_pos];
-    uint32_t sb_amount = (small_blind->chips >= SMALL_BLIND) ? SMALL_BLIND : small_blind->chips;
-    small_blind->bet = sb_amount;
-    small_blind->chips -= sb_amount;
-    if(small_blind->chips == 0) small_blind->all_in = true;
-    
-    // Post big blind
-    Player* big_blind = &app->game.players[app->game.big_blind_pos];
-    uint32_t bb_amount = (big_blind->chips >= BIG_BLIND) ? BIG_BLIND : big_blind->chips;
-    big_blind->bet = bb_amount;
-    big_blind->chips -= bb_amount;
-    if(big_blind->chips == 0) big_blind->all_in = true;
-    
-    app->game.current_bet = bb_amount;
-    app->game.blinds_posted = true;
+    furi_timer_start(app->notification_timer, furi_ms_to_ticks(GAME_NOTIFICATION_MS));
 }
 
 static void game_update_ai_models(TexasHoldemApp* app, uint8_t player_id, PlayerAction action) {
@@ -546,13 +510,60 @@ static void game_update_ai_models(TexasHoldemApp* app, uint8_t player_id, Player
     }
 }
 
+static bool game_history_sink(void* context, const void* data, size_t size) {
+    return storage_file_write((File*)context, data, size) == size;
+}
+
+static void game_history_open(TexasHoldemApp* app) {
+    app->storage = furi_record_open(RECORD_STORAGE);
+    app->history_file = storage_file_alloc(app->storage);
+    if(!storage_file_open(app->history_file, GAME_HISTORY_PATH, FSAM_WRITE, FSOM_OPEN_APPEND)) {
+        storage_file_free(app->history_file);
+        app->history_file = NULL;
+        return;
+    }
+    
+    hand_history_writer_init(&app->history, game_history_sink, app->history_file);
+    if(storage_file_size(app->history_file) == 0) {
+        hand_history_write_header(&app->history);
+    }
+}
+
+static void game_history_close(TexasHoldemApp* app) {
+    if(app->history_file) {
+        hand_history_flush(&app->history);
+        storage_file_close(app->history_file);
+        storage_file_free(app->history_file);
+    }
+    furi_record_close(RECORD_STORAGE);
+}
+
 int32_t texas_holdem_app(void* p) {
     UNUSED(p);
     
     TexasHoldemApp* app = malloc(sizeof(TexasHoldemApp));
     
+    // Event rings and timers first: starting the first hand may arm a timer
+    app->app_thread = furi_thread_get_current_id();
+    spsc_ring_init(&app->input_ring, app->input_events, sizeof(GameEvent), COUNT_OF(app->input_events));
+    spsc_ring_init(&app->timer_ring, app->timer_events, sizeof(GameEvent), COUNT_OF(app->timer_events));
+    spsc_ring_init(&app->ai_ring, app->ai_events, sizeof(GameEvent), COUNT_OF(app->ai_events));
+    app->ai_timer = furi_timer_alloc(ai_timer_callback, FuriTimerTypeOnce, app);
+    app->next_hand_timer = furi_timer_alloc(next_hand_timer_callback, FuriTimerTypeOnce, app);
+    app->notification_timer = furi_timer_alloc(notification_timer_callback, FuriTimerTypeOnce, app);
+    // Evaluator tables are filled once here, before the AI worker thread
+    // exists; the evaluators read them without checking
+    poker_eval_init();
+    app->ai_worker = ai_worker_alloc(ai_decision_callback, app);
+    app->ai_request_id = 0;
+    game_history_open(app);
+    
     // Initialize app
     game_init(app);
+    atomic_init(&app->view_published, 0);
+    atomic_init(&app->view_reading, GAME_VIEW_NONE);
+    app->view_valid = false;
+    game_publish_view(app);
     
     // Set up GUI
     Gui* gui = furi_record_open(RECORD_GUI);
@@ -561,18 +572,28 @@ int32_t texas_holdem_app(void* p) {
     view_port_input_callback_set(view_port, input_callback, app);
     gui_add_view_port(gui, view_port, GuiLayerFullscreen);
     
-    // Set up timer
-    app->game_timer = furi_timer_alloc(timer_callback, FuriTimerTypePeriodic, app);
-    furi_timer_start(app->game_timer, furi_ms_to_ticks(50)); // 20 FPS
-    
-    // Main loop
+    // Main loop: sleep until an event arrives, handle everything queued,
+    // then publish one view and redraw only if it changed
+    GameEvent event;
     while(!app->game.game_over) {
-        furi_delay_ms(100);
+        furi_thread_flags_wait(GAME_FLAG_EVENT, FuriFlagWaitAny, FuriWaitForever);
+        while(!app->game.game_over && game_next_event(app, &event)) {
+            game_handle_event(app, &event);
+        }
+        if(game_publish_view(app)) {
+            view_port_update(view_port);
+        }
     }
     
     // Cleanup
-    furi_timer_stop(app->game_timer);
-    furi_timer_free(app->game_timer);
+    furi_timer_stop(app->ai_timer);
+    furi_timer_stop(app->next_hand_timer);
+    furi_timer_stop(app->notification_timer);
+    furi_timer_free(app->ai_timer);
+    furi_timer_free(app->next_hand_timer);
+    furi_timer_free(app->notification_timer);
+    ai_worker_free(app->ai_worker);
+    game_history_close(app);
     view_port_enabled_set(view_port, false);
     gui_remove_view_port(gui, view_port);
     view_port_free(view_port);
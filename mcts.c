@@ -0,0 +1,346 @@
+#include "mcts.h"
+#include "ai.h"
+#include "platform.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if PLATFORM_HAS_THREADS
+#include <pthread.h>
+#define MCTS_MAX_THREADS 64
+#else
+#define MCTS_MAX_THREADS 1
+#endif
+
+#define MCTS_NO_NODE 0xFFFF
+// Longest action sequence kept in the tree; deeper play is rollout only
+#define MCTS_MAX_DEPTH 48
+// Iterations between clock reads when a time budget is set
+#define MCTS_TIME_CHECK_MASK 0x0F
+// Below this many iterations per thread a second tree is not worth it
+#define MCTS_MIN_ITERATIONS_PER_THREAD 500
+// UCB1 exploration constant, for rewards scaled to the chips in play
+#define MCTS_EXPLORATION 0.7f
+
+// Children of a node are allocated together, in engine_legal_actions order,
+// so child i of a node is the i-th legal action there
+typedef struct {
+    float value; // Sum of the chips won by `seat` through this node
+    uint32_t visits;
+    uint16_t first_child; // MCTS_NO_NODE until expanded
+    uint8_t child_count;
+    uint8_t seat; // Who chose the action leading here
+} MctsNode;
+
+// Bump allocator over a fixed array; a search never frees single nodes
+typedef struct {
+    MctsNode* nodes;
+    uint16_t capacity;
+    uint16_t used;
+} MctsPool;
+
+typedef struct {
+    const GameState* root;
+    uint8_t seat;
+    uint32_t quota; // 0 = run until the deadline
+    uint64_t deadline_us; // 0 = no deadline
+    float scale; // Chips in play at the root, to normalize rewards
+    Rng rng;
+    MctsPool pool;
+    AIPlayer model[MAX_PLAYERS]; // Opponent model per seat, see mcts_policy
+
+    uint32_t done;
+} MctsWorker;
+
+static bool mcts_pool_init(MctsPool* pool, uint16_t capacity) {
+    pool->nodes = malloc(sizeof(MctsNode) * capacity);
+    pool->capacity = pool->nodes ? capacity : 0;
+    pool->used = 0;
+    return pool->nodes != NULL;
+}
+
+// First of `count` fresh nodes, or MCTS_NO_NODE when the arena is full
+static uint16_t mcts_pool_alloc(MctsPool* pool, uint8_t count, uint8_t seat) {
+    if(pool->capacity - pool->used < count) return MCTS_NO_NODE;
+    uint16_t first = pool->used;
+    for(uint8_t i = 0; i < count; i++) {
+        pool->nodes[first + i] = (MctsNode){0.0f, 0, MCTS_NO_NODE, 0, seat};
+    }
+    pool->used += count;
+    return first;
+}
+
+static void mcts_pool_free(MctsPool* pool) {
+    free(pool->nodes);
+    pool->nodes = NULL;
+}
+
+// Replaces everything the searching player cannot see: opponents' hole
+// cards come off the top of `deck`, which then deals the rest of the board
+static void mcts_determinize(GameState* game, uint8_t seat) {
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        Player* player = &game->players[i];
+        if(i == seat || player->folded) continue;
+        player->hand[0] = poker_deal_card(&game->deck);
+        player->hand[1] = poker_deal_card(&game->deck);
+        player->hand_set = poker_card_bit(player->hand[0]) | poker_card_bit(player->hand[1]);
+    }
+}
+
+// Opponents, and everybody once the walk leaves the tree, play like the
+// balanced AI_MEDIUM bot with the cards this iteration dealt them. Its
+// action is mapped to the closest of `actions` (engine_legal_actions: fold
+// and call when facing a bet, else check, then the raises).
+static uint8_t mcts_policy(GameState* game, AIPlayer* model, const Action* actions, uint8_t count) {
+    uint8_t seat = game->current_player;
+    uint8_t passive = actions[0].type == ACTION_FOLD ? 1 : 0; // Index of check or call
+
+    switch(ai_decide_action(game, seat, &model[seat])) {
+        case ACTION_FOLD:
+            return 0;
+        case ACTION_CHECK:
+        case ACTION_CALL:
+            return passive;
+        case ACTION_RAISE:
+            break;
+    }
+
+    uint32_t raise_to = game->players[seat].bet + ai_decide_raise_amount(game, seat, &model[seat]);
+    uint8_t best = passive;
+    uint32_t best_distance = UINT32_MAX;
+    for(uint8_t i = passive + 1; i < count; i++) {
+        uint32_t distance = actions[i].amount > raise_to ? actions[i].amount - raise_to : raise_to - actions[i].amount;
+        if(distance < best_distance) {
+            best_distance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// UCB1 over the children; unvisited children first
+static uint8_t mcts_select(const MctsNode* nodes, const MctsNode* node, float scale) {
+    const MctsNode* children = &nodes[node->first_child];
+    float log_visits = logf((float)node->visits);
+    float best_score = -INFINITY;
+    uint8_t best = 0;
+
+    for(uint8_t i = 0; i < node->child_count; i++) {
+        if(children[i].visits == 0) return i;
+        float mean = children[i].value / children[i].visits / scale;
+        float score = mean + MCTS_EXPLORATION * sqrtf(log_visits / children[i].visits);
+        if(score > best_score) {
+            best_score = score;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Chips won (or lost) by every seat since the root, paid as engine_showdown
+// would (side pots, uncalled bets) without touching the game's bookkeeping
+static void mcts_payoff(const GameState* game, const uint32_t* root_chips, float* payoff) {
+    ShowdownResult result;
+    engine_payout(game, &result);
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        uint32_t chips = game->players[i].chips + result.won[i] + result.returned[i];
+        payoff[i] = (float)chips - (float)root_chips[i];
+    }
+}
+
+static void mcts_run_worker(MctsWorker* worker) {
+    const GameState* root = worker->root;
+    MctsNode* nodes = worker->pool.nodes;
+    GameState game;
+    Action actions[ENGINE_MAX_ACTIONS];
+    uint16_t path[MCTS_MAX_DEPTH + 1];
+    uint32_t root_chips[MAX_PLAYERS];
+    float payoff[MAX_PLAYERS];
+
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        root_chips[i] = root->players[i].chips;
+    }
+
+    // The searcher's deck: everything but its own cards and the board. Each
+    // iteration starts from a copy with a fresh dealing stream (lazy deal),
+    // so a determinization costs no shuffle.
+    Deck deck;
+    poker_init_deck(&deck);
+    poker_deck_remove(&deck, root->players[worker->seat].hand_set | root->community_set);
+    poker_shuffle_deck_lazy(&deck, &worker->rng);
+
+    uint16_t root_index = mcts_pool_alloc(&worker->pool, 1, worker->seat);
+    if(root_index == MCTS_NO_NODE) return;
+
+    while(worker->quota == 0 || worker->done < worker->quota) {
+        if(worker->deadline_us && (worker->done & MCTS_TIME_CHECK_MASK) == 0 &&
+           platform_time_us() >= worker->deadline_us) {
+            break;
+        }
+
+        memcpy(&game, root, sizeof(GameState));
+        game.deck = deck;
+        rng_split(&worker->rng, &game.deck.rng);
+        rng_split(&worker->rng, &game.rng);
+        mcts_determinize(&game, worker->seat);
+
+        // Selection and expansion: a node gets its children on its second
+        // visit, so leaves reached only once do not use up the arena
+        uint8_t depth = 0;
+        uint16_t index = root_index;
+        path[depth++] = index;
+        while(game.phase != PHASE_SHOWDOWN && depth <= MCTS_MAX_DEPTH) {
+            MctsNode* node = &nodes[index];
+            uint8_t count = engine_legal_actions(&game, actions);
+            if(count == 0) break;
+
+            if(node->first_child == MCTS_NO_NODE) {
+                if(node->visits == 0 && index != root_index) break;
+                uint16_t first = mcts_pool_alloc(&worker->pool, count, game.current_player);
+                if(first == MCTS_NO_NODE) break;
+                node->first_child = first;
+                node->child_count = count;
+            }
+            if(node->child_count != count) break;
+
+            uint8_t choice = game.current_player == worker->seat ?
+                                 mcts_select(nodes, node, worker->scale) :
+                                 mcts_policy(&game, worker->model, actions, count);
+            engine_apply_action(&game, actions[choice]);
+            index = node->first_child + choice;
+            path[depth++] = index;
+        }
+
+        // Rollout to the end of the hand
+        while(game.phase != PHASE_SHOWDOWN) {
+            uint8_t count = engine_legal_actions(&game, actions);
+            if(count == 0) break;
+            engine_apply_action(&game, actions[mcts_policy(&game, worker->model, actions, count)]);
+        }
+
+        mcts_payoff(&game, root_chips, payoff);
+        for(uint8_t i = 0; i < depth; i++) {
+            MctsNode* node = &nodes[path[i]];
+            node->visits++;
+            node->value += payoff[node->seat];
+        }
+        worker->done++;
+    }
+}
+
+#if PLATFORM_HAS_THREADS
+static void* mcts_thread(void* ctx) {
+    mcts_run_worker((MctsWorker*)ctx);
+    return NULL;
+}
+#endif
+
+// Searches the decision of `seat`, which must be the player to act. Only
+// that player's hole cards are looked at.
+MctsResult mcts_search(const GameState* game, uint8_t seat, const MctsBudget* budget) {
+    MctsResult result = {0};
+    MctsWorker workers[MCTS_MAX_THREADS];
+    uint32_t iterations = budget->max_iterations;
+
+    result.action_count = engine_legal_actions((GameState*)game, result.actions);
+    if(result.action_count == 0) {
+        result.action = (Action){ACTION_CHECK, 0};
+        return result;
+    }
+    // Until the search says otherwise: check or call
+    result.action = result.actions[result.actions[0].type == ACTION_FOLD ? 1 : 0];
+    if(result.action_count == 1) return result;
+
+    if(iterations == 0 && budget->max_time_us == 0) {
+        iterations = MCTS_DEFAULT_ITERATIONS;
+    }
+
+    uint8_t threads = budget->threads ? budget->threads : platform_cpu_count();
+    if(threads > MCTS_MAX_THREADS) threads = MCTS_MAX_THREADS;
+    if(iterations && iterations / threads < MCTS_MIN_ITERATIONS_PER_THREAD) {
+        threads = iterations / MCTS_MIN_ITERATIONS_PER_THREAD;
+        if(threads == 0) threads = 1;
+    }
+
+    // Each iteration expands at most one node
+    uint32_t capacity = MCTS_POOL_NODES;
+    if(iterations && (uint64_t)iterations * ENGINE_MAX_ACTIONS / threads + 1 < capacity) {
+        capacity = (uint32_t)((uint64_t)iterations * ENGINE_MAX_ACTIONS / threads + 1);
+    }
+
+    // Rewards are scaled by what the searcher can still win or lose
+    uint32_t in_play = game->pot + game->players[seat].chips;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        in_play += game->players[i].bet;
+    }
+
+    Rng root;
+    rng_seed(&root, budget->seed, 0);
+    uint64_t deadline = budget->max_time_us ? platform_time_us() + budget->max_time_us : 0;
+
+    AIPlayer bots[MAX_PLAYERS - 1];
+    ai_init_players(bots);
+
+    uint8_t ready = 0;
+    for(uint8_t i = 0; i < threads; i++) {
+        MctsWorker* worker = &workers[i];
+        memset(worker, 0, sizeof(MctsWorker));
+        if(!mcts_pool_init(&worker->pool, (uint16_t)capacity)) break;
+        worker->root = game;
+        worker->seat = seat;
+        worker->quota = iterations / threads + (i < iterations % threads ? 1 : 0);
+        worker->deadline_us = deadline;
+        worker->scale = (float)in_play;
+        for(uint8_t s = 0; s < MAX_PLAYERS; s++) {
+            worker->model[s] = bots[MAX_PLAYERS - 2];
+        }
+        rng_split(&root, &worker->rng);
+        ready++;
+    }
+    // Out of memory: the check or call stands
+    if(ready == 0) return result;
+    threads = ready;
+
+#if PLATFORM_HAS_THREADS
+    pthread_t handles[MCTS_MAX_THREADS];
+    uint8_t started = 1;
+    for(uint8_t i = 1; i < threads; i++) {
+        if(pthread_create(&handles[i], NULL, mcts_thread, &workers[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+    // A tree that never started just adds nothing
+    mcts_run_worker(&workers[0]);
+    for(uint8_t i = 1; i < started; i++) {
+        pthread_join(handles[i], NULL);
+    }
+#else
+    mcts_run_worker(&workers[0]);
+#endif
+
+    // Root parallelism: add up the root children of every tree
+    float value_sum[ENGINE_MAX_ACTIONS] = {0};
+    for(uint8_t i = 0; i < threads; i++) {
+        MctsWorker* worker = &workers[i];
+        result.iterations += worker->done;
+        result.nodes += worker->pool.used;
+        const MctsNode* root_node = &worker->pool.nodes[0];
+        if(worker->pool.used > 0 && root_node->child_count == result.action_count) {
+            for(uint8_t a = 0; a < result.action_count; a++) {
+                const MctsNode* child = &worker->pool.nodes[root_node->first_child + a];
+                result.visits[a] += child->visits;
+                value_sum[a] += child->value;
+            }
+        }
+        mcts_pool_free(&worker->pool);
+    }
+
+    uint8_t best = 0;
+    for(uint8_t a = 0; a < result.action_count; a++) {
+        if(result.visits[a] > 0) result.value[a] = value_sum[a] / result.visits[a];
+        if(result.visits[a] > result.visits[best]) best = a;
+    }
+    if(result.visits[best] > 0) result.action = result.actions[best];
+    return result;
+}
\ No newline at end of file
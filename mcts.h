@@ -0,0 +1,50 @@
+#pragma once
+
+#include "engine.h"
+
+// Information-set Monte Carlo tree search for one betting decision, used by
+// AI_HARD. Every iteration deals the cards the searching player cannot see
+// (opponents' hole cards and the rest of the board) at random, then walks
+// a tree of public betting sequences from the current position. The
+// searcher's own decisions are picked by UCB1; opponents, and everybody in
+// the rollout after the last tree node, play like the balanced AI_MEDIUM
+// bot on their dealt cards. The tree's actions are engine_legal_actions: fold,
+// check/call and raises to the minimum, to the pot and all-in.
+//
+// Nodes come from a fixed arena allocated once per search thread, so the
+// search does no allocation per node; when the arena is full the tree
+// stops growing and iterations keep refining the existing nodes. The
+// search is anytime: stopping it at any point gives the best action so
+// far. On the host it can grow several independent trees on separate
+// threads (root parallelism) and add up their root statistics.
+
+// Arena size per search thread; a node is 12 bytes
+#ifdef HOLDEM_HOST
+#define MCTS_POOL_NODES 65535
+#else
+#define MCTS_POOL_NODES 1024
+#endif
+
+// Work limits, as for EquityBudget: whichever is hit first ends the search
+typedef struct {
+    uint32_t max_iterations; // Total over all threads, 0 = no limit
+    uint32_t max_time_us; // Wall clock limit, 0 = no limit
+    uint8_t threads; // Search threads, 0 = one per core (always 1 on device)
+    uint64_t seed;
+} MctsBudget;
+
+typedef struct {
+    Action action; // Most visited root action
+    uint8_t action_count; // Legal actions at the root
+    Action actions[ENGINE_MAX_ACTIONS];
+    uint32_t visits[ENGINE_MAX_ACTIONS];
+    float value[ENGINE_MAX_ACTIONS]; // Mean chips won from here on
+    uint32_t iterations;
+    uint32_t nodes; // Tree nodes used, over all threads
+} MctsResult;
+
+// Iterations when a budget sets no limit at all
+#define MCTS_DEFAULT_ITERATIONS 1000
+
+// Function declarations
+MctsResult mcts_search(const GameState* game, uint8_t seat, const MctsBudget* budget);
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+
+// The few OS services the poker core needs (clocks, core count), for the
+// Flipper firmware and for the host build (HOLDEM_HOST, see host/Makefile).
+
+#ifdef HOLDEM_HOST
+
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define PLATFORM_HAS_THREADS 1
+
+static inline uint64_t platform_time_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+// Free-running counter for short intervals (wraps; subtract as uint32_t)
+static inline uint32_t platform_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+static inline uint8_t platform_cpu_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if(count < 1) return 1;
+    if(count > 255) return 255;
+    return (uint8_t)count;
+}
+
+#else
+
+#include <furi.h>
+#include <furi_hal_cortex.h>
+
+#define PLATFORM_HAS_THREADS 0
+
+static inline uint64_t platform_time_us(void) {
+    return (uint64_t)furi_get_tick() * 1000000 / furi_kernel_get_tick_frequency();
+}
+
+// DWT cycle counter (furi keeps it running)
+static inline uint32_t platform_cycles(void) {
+    return furi_hal_cortex_timer_get(0).start;
+}
+
+static inline uint8_t platform_cpu_count(void) {
+    return 1;
+}
+
+#endif
\ No newline at end of file
@@ -1,43 +1,77 @@
 #include "poker.h"
-#include <furi.h>
-#include <stdlib.h>
+#include "profile.h"
 
 void poker_init_deck(Deck* deck) {
-    uint8_t index = 0;
-    
-    // Initialize deck with all 52 cards
-    for(uint8_t suit = SUIT_HEARTS; suit <= SUIT_SPADES; suit++) {
-        for(uint8_t rank = RANK_2; rank <= RANK_ACE; rank++) {
-            deck->cards[index].suit = (CardSuit)suit;
-            deck->cards[index].rank = (CardRank)rank;
-            index++;
-        }
+    // Initialize deck with all 52 cards, in card index order
+    for(uint8_t index = 0; index < DECK_SIZE; index++) {
+        deck->cards[index] = index;
     }
     
     deck->top = 0;
+    deck->dealt = 0;
+    deck->lazy = false;
+}
+
+static inline void poker_swap_cards(Deck* deck, uint8_t i, uint8_t j) {
+    Card temp = deck->cards[i];
+    deck->cards[i] = deck->cards[j];
+    deck->cards[j] = temp;
 }
 
-void poker_shuffle_deck(Deck* deck) {
-    // Fisher-Yates shuffle algorithm
-    for(uint8_t i = DECK_SIZE - 1; i > 0; i--) {
-        uint8_t j = rand() % (i + 1);
-        
-        // Swap cards[i] and cards[j]
-        Card temp = deck->cards[i];
-        deck->cards[i] = deck->cards[j];
-        deck->cards[j] = temp;
+void poker_shuffle_deck(Deck* deck, Rng* rng) {
+    // Fisher-Yates shuffle of the cards not dealt yet, front to back. This
+    // is exactly the sequence of swaps lazy dealing performs one card at a
+    // time, so both modes deal the same cards from the same generator state.
+    for(uint8_t i = deck->top; i < DECK_SIZE - 1; i++) {
+        poker_swap_cards(deck, i, i + rng_bounded(rng, DECK_SIZE - i));
+    }
+    deck->lazy = false;
+}
+
+void poker_shuffle_deck_lazy(Deck* deck, Rng* rng) {
+    // Nothing moves now; each poker_deal_card picks its card uniformly from
+    // the undealt part of the deck (partial Fisher-Yates)
+    deck->rng = *rng;
+    deck->lazy = true;
+}
+
+void poker_deck_remove(Deck* deck, CardSet dead) {
+    // Move known cards (hero's hand, the board...) in front of top so they
+    // can never be dealt. Positions past top are either unshuffled (lazy) or
+    // uniformly shuffled, and swapping keeps them that way.
+    dead &= ~deck->dealt;
+    for(uint8_t i = deck->top; dead && i < DECK_SIZE; i++) {
+        CardSet bit = poker_card_bit(deck->cards[i]);
+        if(dead & bit) {
+            poker_swap_cards(deck, deck->top++, i);
+            deck->dealt |= bit;
+            dead &= ~bit;
+        }
     }
-    
-    deck->top = 0;
 }
 
 Card poker_deal_card(Deck* deck) {
     if(deck->top >= DECK_SIZE) {
         // Reset deck if we've run out of cards (shouldn't happen in normal play)
         deck->top = 0;
+        deck->dealt = 0;
     }
     
-    return deck->cards[deck->top++];
+    if(deck->lazy && deck->top < DECK_SIZE - 1) {
+        poker_swap_cards(deck, deck->top, deck->top + rng_bounded(&deck->rng, DECK_SIZE - deck->top));
+    }
+    
+    Card card = deck->cards[deck->top++];
+    deck->dealt |= poker_card_bit(card);
+    return card;
+}
+
+CardSet poker_cards_to_set(Card* cards, uint8_t count) {
+    CardSet set = 0;
+    for(uint8_t i = 0; i < count; i++) {
+        set |= poker_card_bit(cards[i]);
+    }
+    return set;
 }
 
 void poker_get_card_string(Card card, char* buffer, size_t buffer_size) {
@@ -45,255 +79,348 @@ void poker_get_card_string(Card card, char* buffer, size_t buffer_size) {
     const char* suit_chars = "HDCS";
     
     if(buffer_size >= 3) {
-        buffer[0] = rank_chars[card.rank - 2];
-        buffer[1] = suit_chars[card.suit];
+        buffer[0] = rank_chars[poker_card_rank(card) - RANK_2];
+        buffer[1] = suit_chars[poker_card_suit(card)];
         buffer[2] = '\0';
     }
 }
 
-// Helper function to count occurrences of each rank
-static void count_ranks(Card* all_cards, uint8_t count, uint8_t* rank_counts) {
-    for(uint8_t i = 0; i < 15; i++) {
-        rank_counts[i] = 0;
-    }
-    
-    for(uint8_t i = 0; i < count; i++) {
-        rank_counts[all_cards[i].rank]++;
-    }
+static char poker_upper(char c) {
+    return (c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c;
 }
 
-// Helper function to count occurrences of each suit
-static void count_suits(Card* all_cards, uint8_t count, uint8_t* suit_counts) {
-    for(uint8_t i = 0; i < 4; i++) {
-        suit_counts[i] = 0;
+// Parse one card written as rank + suit ("As", "td", "10h"), case insensitive
+bool poker_parse_card(const char* text, Card* card) {
+    const char* rank_chars = "23456789TJQKA";
+    const char* suit_chars = "HDCS";
+    int8_t rank = -1, suit = -1;
+
+    if(text[0] == '1' && text[1] == '0') {
+        rank = RANK_10 - RANK_2;
+        text++;
+    } else {
+        for(uint8_t i = 0; i < 13; i++) {
+            if(poker_upper(text[0]) == rank_chars[i]) rank = i;
+        }
     }
-    
-    for(uint8_t i = 0; i < count; i++) {
-        suit_counts[all_cards[i].suit]++;
+    if(rank < 0 || text[0] == '\0') return false;
+    for(uint8_t i = 0; i < 4; i++) {
+        if(poker_upper(text[1]) == suit_chars[i]) suit = i;
     }
+    if(suit < 0) return false;
+
+    *card = poker_make_card((CardRank)(rank + RANK_2), (CardSuit)suit);
+    return true;
 }
 
-// Check for flush
-static bool is_flush(uint8_t* suit_counts, CardSuit* flush_suit) {
-    for(uint8_t i = 0; i < 4; i++) {
-        if(suit_counts[i] >= 5) {
-            *flush_suit = (CardSuit)i;
-            return true;
+// Parse a run of cards ("AhKs", "2c 7d 9h"); returns the number of cards or
+// -1 on a malformed or repeated card
+int8_t poker_parse_cards(const char* text, CardSet* cards) {
+    int8_t count = 0;
+    *cards = 0;
+
+    while(*text) {
+        if(*text == ' ' || *text == ',') {
+            text++;
+            continue;
         }
+        Card card;
+        if(!poker_parse_card(text, &card) || (*cards & poker_card_bit(card))) return -1;
+        *cards |= poker_card_bit(card);
+        count++;
+        text += (text[0] == '1') ? 3 : 2;
     }
-    return false;
+    return count;
 }
 
-// Check for straight
-static bool is_straight(uint8_t* rank_counts, uint8_t* straight_high) {
-    // Check for regular straight
-    for(uint8_t i = RANK_ACE; i >= RANK_6; i--) {
-        bool found = true;
-        for(uint8_t j = 0; j < 5; j++) {
-            if(rank_counts[i - j] == 0) {
-                found = false;
+// Hand evaluation works on 13-bit rank masks (bit 0 = deuce, bit 12 = ace),
+// one per suit lane of a CardSet. Everything that used to be a loop over the
+// cards is a lookup into one of these tables, indexed by a rank mask.
+#define RANK_MASK_COUNT (1 << 13)
+#define RANK_BIT(rank) (1u << ((rank) - RANK_2))
+
+// First strength of each category; classes within a category are dense
+#define STRENGTH_HIGH_CARD 1
+#define STRENGTH_PAIR (STRENGTH_HIGH_CARD + 1277)
+#define STRENGTH_TWO_PAIR (STRENGTH_PAIR + 13 * 220)
+#define STRENGTH_THREE_KIND (STRENGTH_TWO_PAIR + 78 * 11)
+#define STRENGTH_STRAIGHT (STRENGTH_THREE_KIND + 13 * 66)
+#define STRENGTH_FLUSH (STRENGTH_STRAIGHT + 10)
+#define STRENGTH_FULL_HOUSE (STRENGTH_FLUSH + 1277)
+#define STRENGTH_FOUR_KIND (STRENGTH_FULL_HOUSE + 13 * 12)
+#define STRENGTH_STRAIGHT_FLUSH (STRENGTH_FOUR_KIND + 13 * 12)
+
+static const uint16_t category_base[] = {
+    STRENGTH_HIGH_CARD,
+    STRENGTH_PAIR,
+    STRENGTH_TWO_PAIR,
+    STRENGTH_THREE_KIND,
+    STRENGTH_STRAIGHT,
+    STRENGTH_FLUSH,
+    STRENGTH_FULL_HOUSE,
+    STRENGTH_FOUR_KIND,
+    STRENGTH_STRAIGHT_FLUSH,
+    HAND_STRENGTH_MAX, // Royal flush is the top straight flush
+};
+
+static uint8_t eval_bit_count[RANK_MASK_COUNT];
+static uint8_t eval_straight_high[RANK_MASK_COUNT]; // High rank of best straight, 0 if none
+// Position of a mask among all masks with the same bit count, in increasing
+// order. Five-bit masks that form a straight are skipped, so for five ranks
+// this is directly the high-card/flush class (0-1276).
+static uint16_t eval_kicker_index[RANK_MASK_COUNT];
+static bool eval_tables_ready = false;
+
+// Fills the tables above. Call it once at startup, before any thread
+// evaluates a hand: the evaluators read the tables without checking.
+void poker_eval_init(void) {
+    if(eval_tables_ready) return;
+
+    uint16_t next_index[14] = {0};
+    uint32_t wheel = RANK_BIT(RANK_ACE) | RANK_BIT(RANK_2) | RANK_BIT(RANK_3) |
+                     RANK_BIT(RANK_4) | RANK_BIT(RANK_5);
+
+    for(uint32_t mask = 0; mask < RANK_MASK_COUNT; mask++) {
+        uint8_t count = (uint8_t)__builtin_popcount(mask);
+        eval_bit_count[mask] = count;
+
+        // Check for straight, then for A-2-3-4-5 (wheel)
+        eval_straight_high[mask] = 0;
+        for(uint8_t high = RANK_ACE; high >= RANK_6; high--) {
+            uint32_t run = 0x1F << (high - RANK_6);
+            if((mask & run) == run) {
+                eval_straight_high[mask] = high;
                 break;
             }
         }
-        if(found) {
-            *straight_high = i;
-            return true;
+        if(eval_straight_high[mask] == 0 && (mask & wheel) == wheel) {
+            eval_straight_high[mask] = RANK_5;
+        }
+
+        // Increasing mask value is increasing kicker strength for equal counts
+        if(count == 5 && eval_straight_high[mask]) {
+            eval_kicker_index[mask] = 0;
+        } else {
+            eval_kicker_index[mask] = next_index[count]++;
         }
     }
-    
-    // Check for A-2-3-4-5 straight (wheel)
-    if(rank_counts[RANK_ACE] && rank_counts[RANK_2] && rank_counts[RANK_3] && 
-       rank_counts[RANK_4] && rank_counts[RANK_5]) {
-        *straight_high = RANK_5;
-        return true;
-    }
-    
-    return false;
+
+    eval_tables_ready = true;
 }
 
-HandResult poker_evaluate_hand(Card* hand, Card* community, uint8_t community_count) {
-    HandResult result = {0};
-    Card all_cards[7]; // 2 hole cards + 5 community cards max
-    uint8_t total_cards = HAND_SIZE + community_count;
-    
-    // Combine hole cards and community cards
-    for(uint8_t i = 0; i < HAND_SIZE; i++) {
-        all_cards[i] = hand[i];
-    }
-    for(uint8_t i = 0; i < community_count; i++) {
-        all_cards[HAND_SIZE + i] = community[i];
+// Index (0-12) of the highest rank in a non-empty mask
+static inline uint8_t eval_top_index(uint32_t mask) {
+    return (uint8_t)(31 - __builtin_clz(mask));
+}
+
+// Keep only the highest `count` ranks of a mask
+static inline uint32_t eval_keep_top(uint32_t mask, uint8_t count) {
+    while(eval_bit_count[mask] > count) {
+        mask &= mask - 1;
     }
-    
-    // Count ranks and suits
-    uint8_t rank_counts[15] = {0};
-    uint8_t suit_counts[4] = {0};
-    count_ranks(all_cards, total_cards, rank_counts);
-    count_suits(all_cards, total_cards, suit_counts);
-    
-    // Check for flush and straight
-    CardSuit flush_suit;
-    bool has_flush = is_flush(suit_counts, &flush_suit);
-    uint8_t straight_high;
-    bool has_straight = is_straight(rank_counts, &straight_high);
-    
-    // Determine hand rank
-    if(has_straight && has_flush) {
-        // Check if it's specifically a straight flush in the flush suit
-        bool is_straight_flush = true;
-        for(uint8_t i = 0; i < 5; i++) {
-            bool found = false;
-            uint8_t check_rank = (straight_high == RANK_5 && i == 0) ? RANK_ACE : straight_high - i;
-            
-            for(uint8_t j = 0; j < total_cards; j++) {
-                if(all_cards[j].rank == check_rank && all_cards[j].suit == flush_suit) {
-                    found = true;
-                    break;
-                }
-            }
-            if(!found) {
-                is_straight_flush = false;
-                break;
-            }
-        }
-        
-        if(is_straight_flush) {
-            if(straight_high == RANK_ACE) {
-                result.rank = HAND_ROYAL_FLUSH;
-            } else {
-                result.rank = HAND_STRAIGHT_FLUSH;
-            }
-            result.value = straight_high;
-            return result;
+    return mask;
+}
+
+// Drop bit `index` and shift the ranks above it down, so kickers that can
+// never equal the paired rank index into a 12-rank space
+static inline uint32_t eval_squeeze(uint32_t mask, uint8_t index) {
+    return ((mask >> (index + 1)) << index) | (mask & ((1u << index) - 1));
+}
+
+// Hands with fewer than five cards (AI preflop/partial boards) are ranked as
+// if the missing kickers were the lowest ranks that do not make a straight
+static uint32_t eval_pad_ranks(uint32_t any, uint8_t missing) {
+    for(uint32_t bit = 1; missing > 0 && bit < RANK_MASK_COUNT; bit <<= 1) {
+        if(!(any & bit) && !eval_straight_high[any | bit]) {
+            any |= bit;
+            missing--;
         }
     }
-    
-    // Check for four of a kind
-    for(uint8_t i = RANK_ACE; i >= RANK_2; i--) {
-        if(rank_counts[i] == 4) {
-            result.rank = HAND_FOUR_KIND;
-            result.value = i << 4;
-            // Find kicker
-            for(uint8_t j = RANK_ACE; j >= RANK_2; j--) {
-                if(rank_counts[j] > 0 && j != i) {
-                    result.value |= j;
-                    break;
-                }
-            }
-            return result;
+    return any;
+}
+
+uint16_t poker_hand_rank_u16(CardSet cards) {
+    // Each suit lane of the set is already a rank mask
+    uint32_t s0 = poker_suit_mask(cards, SUIT_HEARTS);
+    uint32_t s1 = poker_suit_mask(cards, SUIT_DIAMONDS);
+    uint32_t s2 = poker_suit_mask(cards, SUIT_CLUBS);
+    uint32_t s3 = poker_suit_mask(cards, SUIT_SPADES);
+
+    // Flush (at most one suit can hold five of seven cards). With a flush
+    // in seven cards neither quads nor a full house is possible.
+    uint32_t flush_mask = 0;
+    if(eval_bit_count[s0] >= 5) flush_mask = s0;
+    if(eval_bit_count[s1] >= 5) flush_mask = s1;
+    if(eval_bit_count[s2] >= 5) flush_mask = s2;
+    if(eval_bit_count[s3] >= 5) flush_mask = s3;
+    if(flush_mask) {
+        uint8_t straight_high = eval_straight_high[flush_mask];
+        if(straight_high) {
+            return STRENGTH_STRAIGHT_FLUSH + straight_high - RANK_5;
         }
+        return STRENGTH_FLUSH + eval_kicker_index[eval_keep_top(flush_mask, 5)];
     }
-    
-    // Check for full house
-    uint8_t trips = 0, pair = 0;
-    for(uint8_t i = RANK_ACE; i >= RANK_2; i--) {
-        if(rank_counts[i] == 3 && trips == 0) {
-            trips = i;
-        } else if(rank_counts[i] >= 2 && pair == 0) {
-            pair = i;
-        }
+
+    // Ranks held at least once, twice, three and four times
+    uint32_t any = s0 | s1 | s2 | s3;
+    uint32_t twos = (s0 & s1) | (s2 & s3) | ((s0 | s1) & (s2 | s3));
+    uint32_t threes = (s0 & s1 & (s2 | s3)) | (s2 & s3 & (s0 | s1));
+    uint32_t fours = s0 & s1 & s2 & s3;
+
+    uint8_t card_count = poker_set_count(cards);
+    if(card_count < 5) {
+        any = eval_pad_ranks(any, 5 - card_count);
     }
-    if(trips && pair) {
-        result.rank = HAND_FULL_HOUSE;
-        result.value = (trips << 4) | pair;
-        return result;
+
+    if(fours) {
+        uint8_t quad = eval_top_index(fours);
+        uint8_t kicker = eval_top_index(any & ~(1u << quad));
+        return STRENGTH_FOUR_KIND + quad * 12 + kicker - (kicker > quad);
     }
-    
-    // Check for flush
-    if(has_flush) {
-        result.rank = HAND_FLUSH;
-        // Find highest 5 cards of flush suit
-        uint8_t flush_cards[5];
-        uint8_t flush_count = 0;
-        for(uint8_t i = RANK_ACE; i >= RANK_2 && flush_count < 5; i--) {
-            for(uint8_t j = 0; j < total_cards; j++) {
-                if(all_cards[j].rank == i && all_cards[j].suit == flush_suit) {
-                    flush_cards[flush_count++] = i;
-                    break;
-                }
-            }
+
+    if(threes) {
+        uint8_t trips = eval_top_index(threes);
+        uint32_t pairs = twos & ~(1u << trips);
+        if(pairs) {
+            uint8_t pair = eval_top_index(pairs);
+            return STRENGTH_FULL_HOUSE + trips * 12 + pair - (pair > trips);
         }
-        result.value = (flush_cards[0] << 16) | (flush_cards[1] << 12) | 
-                      (flush_cards[2] << 8) | (flush_cards[3] << 4) | flush_cards[4];
-        return result;
     }
-    
-    // Check for straight
-    if(has_straight) {
-        result.rank = HAND_STRAIGHT;
-        result.value = straight_high;
-        return result;
+
+    uint8_t straight_high = eval_straight_high[any];
+    if(straight_high) {
+        return STRENGTH_STRAIGHT + straight_high - RANK_5;
     }
-    
-    // Check for three of a kind
-    if(trips) {
-        result.rank = HAND_THREE_KIND;
-        result.value = trips << 8;
-        // Find two highest kickers
-        uint8_t kickers = 0;
-        for(uint8_t i = RANK_ACE; i >= RANK_2 && kickers < 2; i--) {
-            if(rank_counts[i] > 0 && i != trips) {
-                result.value |= i << (4 * (1 - kickers));
-                kickers++;
-            }
-        }
-        return result;
+
+    if(threes) {
+        // Two highest kickers
+        uint8_t trips = eval_top_index(threes);
+        uint32_t kickers = eval_keep_top(any & ~(1u << trips), 2);
+        return STRENGTH_THREE_KIND + trips * 66 + eval_kicker_index[eval_squeeze(kickers, trips)];
     }
-    
-    // Check for pairs
-    uint8_t pairs[2] = {0, 0};
-    uint8_t pair_count = 0;
-    for(uint8_t i = RANK_ACE; i >= RANK_2 && pair_count < 2; i--) {
-        if(rank_counts[i] == 2) {
-            pairs[pair_count++] = i;
+
+    switch(eval_bit_count[twos]) {
+        case 0:
+            return STRENGTH_HIGH_CARD + eval_kicker_index[eval_keep_top(any, 5)];
+
+        case 1: {
+            // Three highest kickers
+            uint8_t pair = eval_top_index(twos);
+            uint32_t kickers = eval_keep_top(any & ~twos, 3);
+            return STRENGTH_PAIR + pair * 220 + eval_kicker_index[eval_squeeze(kickers, pair)];
+        }
+
+        default: {
+            // Best two pairs, kicker may come from a third pair
+            uint32_t pairs = eval_keep_top(twos, 2);
+            uint8_t high_pair = eval_top_index(pairs);
+            uint8_t low_pair = eval_top_index(pairs & ~(1u << high_pair));
+            uint8_t kicker = eval_top_index(any & ~pairs);
+            kicker -= (kicker > low_pair) + (kicker > high_pair);
+            return STRENGTH_TWO_PAIR + eval_kicker_index[pairs] * 11 + kicker;
         }
     }
-    
-    if(pair_count == 2) {
-        result.rank = HAND_TWO_PAIR;
-        result.value = (pairs[0] << 8) | (pairs[1] << 4);
-        // Find kicker
-        for(uint8_t i = RANK_ACE; i >= RANK_2; i--) {
-            if(rank_counts[i] > 0 && i != pairs[0] && i != pairs[1]) {
-                result.value |= i;
-                break;
+}
+
+HandRank poker_hand_category(uint16_t strength) {
+    HandRank rank = HAND_HIGH_CARD;
+    while(rank < HAND_ROYAL_FLUSH && strength >= category_base[rank + 1]) {
+        rank++;
+    }
+    return rank;
+}
+
+// Number of high-card (or flush) classes whose top rank index is below `top`:
+// every five-rank subset of the lower ranks except the straights among them
+static uint16_t eval_classes_below(uint8_t top) {
+    uint32_t subsets = 1;
+    if(top < 5) return 0;
+    for(uint8_t i = 0; i < 5; i++) {
+        subsets = subsets * (top - i) / (i + 1);
+    }
+    return (uint16_t)(subsets - (top - 4));
+}
+
+CardRank poker_hand_primary_rank(uint16_t strength) {
+    HandRank category = poker_hand_category(strength);
+    uint16_t index = strength - category_base[category];
+
+    switch(category) {
+        case HAND_HIGH_CARD:
+        case HAND_FLUSH: {
+            uint8_t top = 4;
+            while(top < 12 && eval_classes_below(top + 1) <= index) {
+                top++;
             }
+            return (CardRank)(top + RANK_2);
         }
-        return result;
-    }
-    
-    if(pair_count == 1) {
-        result.rank = HAND_PAIR;
-        result.value = pairs[0] << 12;
-        // Find three highest kickers
-        uint8_t kickers = 0;
-        for(uint8_t i = RANK_ACE; i >= RANK_2 && kickers < 3; i--) {
-            if(rank_counts[i] > 0 && i != pairs[0]) {
-                result.value |= i << (4 * (2 - kickers));
-                kickers++;
+        case HAND_PAIR:
+            return (CardRank)(index / 220 + RANK_2);
+        case HAND_TWO_PAIR: {
+            // Pairs are numbered in increasing order of (high, low)
+            uint8_t high = 1;
+            while(high < 12 && (high + 1) * high / 2 <= index / 11) {
+                high++;
             }
+            return (CardRank)(high + RANK_2);
         }
-        return result;
+        case HAND_THREE_KIND:
+            return (CardRank)(index / 66 + RANK_2);
+        case HAND_FULL_HOUSE:
+        case HAND_FOUR_KIND:
+            return (CardRank)(index / 12 + RANK_2);
+        default:
+            // Straights: the high card of the run
+            return (CardRank)(index + RANK_5);
     }
-    
-    // High card
-    result.rank = HAND_HIGH_CARD;
-    uint8_t high_cards = 0;
-    for(uint8_t i = RANK_ACE; i >= RANK_2 && high_cards < 5; i--) {
-        if(rank_counts[i] > 0) {
-            result.value |= i << (4 * (4 - high_cards));
-            high_cards++;
+}
+
+HandResult poker_evaluate_hand(Card* hand, Card* community, uint8_t community_count) {
+    return poker_evaluate_set(poker_cards_to_set(hand, HAND_SIZE) |
+                              poker_cards_to_set(community, community_count));
+}
+
+HandResult poker_evaluate_set(CardSet cards) {
+    PROFILE_SCOPE(PROFILE_EVALUATE);
+    HandResult result;
+    result.strength = poker_hand_rank_u16(cards);
+    result.rank = poker_hand_category(result.strength);
+    return result;
+}
+
+uint8_t poker_best_five(CardSet cards, Card* best_hand) {
+    uint8_t count = 0;
+    Card all_cards[7];
+
+    for(CardSet rest = cards; rest && count < 7; rest &= rest - 1) {
+        all_cards[count++] = (Card)__builtin_ctzll(rest);
+    }
+    if(count <= 5) {
+        for(uint8_t i = 0; i < count; i++) {
+            best_hand[i] = all_cards[i];
         }
+        return count;
     }
-    
-    return result;
+
+    // Drop every pair of cards (6 cards: every single card) and keep the
+    // five that reproduce the full hand's strength
+    uint16_t target = poker_hand_rank_u16(cards);
+    for(uint8_t i = 0; i < count; i++) {
+        for(uint8_t j = (count == 7) ? i + 1 : i; j < count; j++) {
+            CardSet five = cards & ~poker_card_bit(all_cards[i]) & ~poker_card_bit(all_cards[j]);
+            if(poker_hand_rank_u16(five) == target) {
+                uint8_t n = 0;
+                for(; five; five &= five - 1) {
+                    best_hand[n++] = (Card)__builtin_ctzll(five);
+                }
+                return 5;
+            }
+        }
+    }
+    return 0;
 }
 
 int poker_compare_hands(HandResult* hand1, HandResult* hand2) {
-    if(hand1->rank > hand2->rank) return 1;
-    if(hand1->rank < hand2->rank) return -1;
-    
-    if(hand1->value > hand2->value) return 1;
-    if(hand1->value < hand2->value) return -1;
-    
-    return 0; // Tie
+    // Strengths are totally ordered, so this is a single subtraction
+    return (int)hand1->strength - (int)hand2->strength;
 }
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
-#include <furi.h>
-#include <gui/gui.h>
-#include <input/input.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rng.h"
 
 #define MAX_PLAYERS 4
 #define STARTING_CHIPS 1000
@@ -37,11 +39,42 @@ typedef enum {
     RANK_ACE
 } CardRank;
 
-// Card structure
-typedef struct {
-    CardRank rank;
-    CardSuit suit;
-} Card;
+// Card: one byte, index = suit * 13 + (rank - RANK_2), 0-51
+typedef uint8_t Card;
+
+// Set of cards as a bitmask, bit n = card index n. Each suit is a 13-bit
+// lane (hearts in bits 0-12, diamonds 13-25, ...), so merging hands, counting
+// suits and tracking dead cards are plain bitwise operations.
+typedef uint64_t CardSet;
+
+#define SUIT_LANE_BITS 13
+#define SUIT_LANE_MASK 0x1FFFu
+#define CARD_SET_FULL ((1ULL << DECK_SIZE) - 1)
+
+static inline Card poker_make_card(CardRank rank, CardSuit suit) {
+    return (Card)(suit * SUIT_LANE_BITS + (rank - RANK_2));
+}
+
+static inline CardRank poker_card_rank(Card card) {
+    return (CardRank)(card % SUIT_LANE_BITS + RANK_2);
+}
+
+static inline CardSuit poker_card_suit(Card card) {
+    return (CardSuit)(card / SUIT_LANE_BITS);
+}
+
+static inline CardSet poker_card_bit(Card card) {
+    return 1ULL << card;
+}
+
+// 13-bit rank mask of one suit (bit 0 = deuce, bit 12 = ace)
+static inline uint32_t poker_suit_mask(CardSet set, CardSuit suit) {
+    return (uint32_t)(set >> (suit * SUIT_LANE_BITS)) & SUIT_LANE_MASK;
+}
+
+static inline uint8_t poker_set_count(CardSet set) {
+    return (uint8_t)__builtin_popcountll(set);
+}
 
 // Hand rankings
 typedef enum {
@@ -57,17 +90,25 @@ typedef enum {
     HAND_ROYAL_FLUSH
 } HandRank;
 
-// Hand evaluation result
+// Hand strength: one of the 7462 distinct five-card equivalence classes,
+// 1 (7-5-4-3-2 offsuit) to HAND_STRENGTH_MAX (royal flush). Higher is better,
+// equal strengths split the pot.
+#define HAND_STRENGTH_MAX 7462
+
+// Hand evaluation result (4 bytes). The best five cards are not stored;
+// use poker_best_five() when they are actually needed.
 typedef struct {
-    HandRank rank;
-    uint32_t value; // For comparing hands of same rank
-    Card best_hand[5]; // Best 5-card hand
+    uint16_t strength; // Totally ordered hand strength
+    uint8_t rank; // HandRank category of strength
 } HandResult;
 
 // Deck structure
 typedef struct {
     Card cards[DECK_SIZE];
     uint8_t top; // Index of next card to deal
+    CardSet dealt; // Cards dealt (or removed) so far
+    bool lazy; // Draw each card on demand instead of shuffling up front
+    Rng rng; // Generator used by lazy dealing
 } Deck;
 
 // Player actions
@@ -78,15 +119,24 @@ typedef enum {
     ACTION_RAISE
 } PlayerAction;
 
+// An action with its size. For ACTION_RAISE, amount is the total bet the
+// player raises to (not the increment); it is ignored for other actions.
+typedef struct {
+    PlayerAction type;
+    uint32_t amount;
+} Action;
+
 // Player structure
 typedef struct {
     Card hand[HAND_SIZE];
+    CardSet hand_set; // Same cards as hand[], as a set
     uint32_t chips;
     uint32_t bet;
+    uint32_t committed; // Chips put in this hand, every street (side pots)
     bool folded;
     bool all_in;
+    bool acted; // Acted since the last bet/raise on this street
     PlayerAction last_action;
-    char name[16];
 } Player;
 
 // Game phases
@@ -98,10 +148,13 @@ typedef enum {
     PHASE_SHOWDOWN
 } GamePhase;
 
-// Game state
+// Game state. Plain data with no pointers (display names live in the UI), so
+// a position can be copied with memcpy and stepped by the engine, e.g. by
+// search-based AIs or the simulator.
 typedef struct {
     Player players[MAX_PLAYERS];
     Card community[COMMUNITY_SIZE];
+    CardSet community_set; // Same cards as community[], as a set
     uint8_t community_count;
     Deck deck;
     GamePhase phase;
@@ -115,12 +168,25 @@ typedef struct {
     uint8_t big_blind_pos;
     bool blinds_posted;
     uint32_t hand_number;
+    uint64_t seed; // Session seed, deals are a function of (seed, hand_number)
+    Rng rng; // Per-hand stream for AI decisions
 } GameState;
 
 // Function declarations
 void poker_init_deck(Deck* deck);
-void poker_shuffle_deck(Deck* deck);
+void poker_shuffle_deck(Deck* deck, Rng* rng);
+void poker_shuffle_deck_lazy(Deck* deck, Rng* rng);
+void poker_deck_remove(Deck* deck, CardSet dead);
 Card poker_deal_card(Deck* deck);
+void poker_eval_init(void);
 HandResult poker_evaluate_hand(Card* hand, Card* community, uint8_t community_count);
+HandResult poker_evaluate_set(CardSet cards);
+uint16_t poker_hand_rank_u16(CardSet cards);
+HandRank poker_hand_category(uint16_t strength);
+CardRank poker_hand_primary_rank(uint16_t strength);
+uint8_t poker_best_five(CardSet cards, Card* best_hand);
+CardSet poker_cards_to_set(Card* cards, uint8_t count);
 int poker_compare_hands(HandResult* hand1, HandResult* hand2);
-void poker_get_card_string(Card card, char* buffer, size_t buffer_size);
\ No newline at end of file
+void poker_get_card_string(Card card, char* buffer, size_t buffer_size);
+bool poker_parse_card(const char* text, Card* card);
+int8_t poker_parse_cards(const char* text, CardSet* cards);
\ No newline at end of file
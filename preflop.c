@@ -0,0 +1,61 @@
+#include "preflop.h"
+
+#include <stdio.h>
+
+// Classes are laid out as a 13x13 grid of (rank, rank) indexed from the ace
+// down: pairs on the diagonal, suited hands above it (row = higher rank) and
+// offsuit hands below it (row = lower rank).
+uint8_t preflop_class(CardSet hole) {
+    Card cards[HAND_SIZE];
+    uint8_t count = 0;
+
+    while(hole && count < HAND_SIZE) {
+        cards[count++] = (Card)__builtin_ctzll(hole);
+        hole &= hole - 1;
+    }
+
+    uint8_t high = RANK_ACE - poker_card_rank(cards[0]);
+    uint8_t low = RANK_ACE - poker_card_rank(cards[1]);
+    if(high > low) {
+        uint8_t swap = high;
+        high = low;
+        low = swap;
+    }
+
+    if(poker_card_suit(cards[0]) == poker_card_suit(cards[1])) {
+        return high * 13 + low;
+    }
+    return low * 13 + high;
+}
+
+// One concrete hand of a class (hearts, plus diamonds when offsuit)
+CardSet preflop_class_hand(uint8_t hand_class) {
+    uint8_t row = hand_class / 13;
+    uint8_t column = hand_class % 13;
+    CardRank first = (CardRank)(RANK_ACE - row);
+    CardRank second = (CardRank)(RANK_ACE - column);
+    CardSuit second_suit = row < column ? SUIT_HEARTS : SUIT_DIAMONDS;
+
+    return poker_card_bit(poker_make_card(first, SUIT_HEARTS)) |
+           poker_card_bit(poker_make_card(second, second_suit));
+}
+
+void preflop_class_name(uint8_t hand_class, char* buffer, size_t buffer_size) {
+    static const char ranks[] = "AKQJT98765432";
+    uint8_t row = hand_class / 13;
+    uint8_t column = hand_class % 13;
+
+    if(row == column) {
+        snprintf(buffer, buffer_size, "%c%c", ranks[row], ranks[row]);
+    } else if(row < column) {
+        snprintf(buffer, buffer_size, "%c%cs", ranks[row], ranks[column]);
+    } else {
+        snprintf(buffer, buffer_size, "%c%co", ranks[column], ranks[row]);
+    }
+}
+
+float preflop_equity(CardSet hole, uint8_t opponents) {
+    if(opponents < 1) opponents = 1;
+    if(opponents > PREFLOP_MAX_OPPONENTS) opponents = PREFLOP_MAX_OPPONENTS;
+    return preflop_equity_table[preflop_class(hole)][opponents - 1] / 65535.0f;
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "poker.h"
+
+// Preflop all-in equity of the 169 starting-hand classes (13 pairs, 78
+// suited and 78 offsuit hands) against 1 to PREFLOP_MAX_OPPONENTS random
+// hands. The table itself lives in preflop_table.c, which is generated on the
+// host by host/preflop_gen.c (make -C host preflop-table) and compiled into
+// flash, so preflop decisions cost one lookup.
+
+#define PREFLOP_CLASSES 169
+#define PREFLOP_MAX_OPPONENTS 9
+
+// Equity scaled to 0-65535
+extern const uint16_t preflop_equity_table[PREFLOP_CLASSES][PREFLOP_MAX_OPPONENTS];
+
+// Function declarations
+uint8_t preflop_class(CardSet hole);
+CardSet preflop_class_hand(uint8_t hand_class);
+void preflop_class_name(uint8_t hand_class, char* buffer, size_t buffer_size);
+float preflop_equity(CardSet hole, uint8_t opponents);
\ No newline at end of file
@@ -0,0 +1,176 @@
+// Generated by host/preflop_gen.c (1000000 rollouts per entry, seed 1),
+// do not edit. Regenerate with: make -C host preflop-table
+
+#include "preflop.h"
+
+const uint16_t preflop_equity_table[PREFLOP_CLASSES][PREFLOP_MAX_OPPONENTS] = {
+    {55810, 48096, 41897, 36624, 32270, 28526, 25388, 22669, 20403}, // AA
+    {43964, 33231, 27106, 23221, 20377, 18153, 16396, 14878, 13518}, // AKs
+    {43399, 32409, 26141, 22123, 19244, 17026, 15270, 13784, 12594}, // AQs
+    {42816, 31605, 25195, 21164, 18287, 16153, 14431, 13024, 11842}, // AJs
+    {42321, 30852, 24347, 20291, 17569, 15376, 13781, 12420, 11363}, // ATs
+    {41180, 29244, 22605, 18554, 15871, 13819, 12272, 11061, 10059}, // A9s
+    {40621, 28500, 21960, 17947, 15222, 13254, 11774, 10614,  9693}, // A8s
+    {39949, 27789, 21192, 17288, 14682, 12776, 11357, 10302,  9386}, // A7s
+    {39288, 26950, 20456, 16651, 14134, 12329, 11004,  9996,  9120}, // A6s
+    {39261, 27172, 20859, 16983, 14570, 12804, 11405, 10319,  9466}, // A5s
+    {38649, 26547, 20280, 16640, 14181, 12477, 11183, 10196,  9324}, // A4s
+    {38161, 25981, 19763, 16226, 13851, 12229, 10927,  9967,  9160}, // A3s
+    {37651, 25428, 19300, 15790, 13478, 11898, 10670,  9704,  8873}, // A2s
+    {42785, 31630, 25286, 21113, 18206, 15991, 14138, 12616, 11253}, // AKo
+    {53990, 45168, 38187, 32641, 28169, 24471, 21534, 19149, 17067}, // KK
+    {41544, 30868, 25014, 21298, 18529, 16464, 14790, 13337, 12209}, // KQs
+    {41027, 30021, 24105, 20419, 17587, 15606, 13968, 12663, 11564}, // KJs
+    {40509, 29315, 23373, 19565, 16938, 14907, 13369, 12102, 11094}, // KTs
+    {39347, 27781, 21572, 17808, 15187, 13329, 11880, 10678,  9761}, // K9s
+    {38171, 26324, 20156, 16436, 13975, 12178, 10875,  9786,  8874}, // K8s
+    {37705, 25709, 19603, 15966, 13559, 11797, 10458,  9428,  8626}, // K7s
+    {37073, 25074, 19026, 15441, 13109, 11479, 10107,  9207,  8365}, // K6s
+    {36552, 24513, 18562, 15078, 12787, 11151,  9897,  8922,  8209}, // K5s
+    {35972, 23943, 18051, 14711, 12447, 10927,  9725,  8750,  8070}, // K4s
+    {35448, 23360, 17539, 14307, 12209, 10725,  9529,  8694,  7908}, // K3s
+    {34880, 22920, 17160, 13941, 11936, 10435,  9402,  8545,  7835}, // K2s
+    {42243, 30722, 24123, 19925, 16981, 14702, 12923, 11430, 10194}, // AQo
+    {40177, 29109, 23068, 19131, 16396, 14263, 12578, 11089,  9933}, // KQo
+    {52365, 42537, 35140, 29299, 24817, 21301, 18529, 16365, 14562}, // QQ
+    {39553, 29015, 23326, 19748, 17132, 15187, 13591, 12335, 11269}, // QJs
+    {38942, 28247, 22612, 19009, 16452, 14563, 13082, 11868, 10863}, // QTs
+    {37822, 26645, 20852, 17271, 14776, 13021, 11624, 10442,  9543}, // Q9s
+    {36676, 25275, 19423, 15977, 13564, 11843, 10508,  9502,  8612}, // Q8s
+    {35585, 23938, 18157, 14780, 12476, 10916,  9613,  8679,  7926}, // Q7s
+    {35188, 23398, 17693, 14363, 12108, 10535,  9385,  8451,  7706}, // Q6s
+    {34549, 22827, 17191, 13897, 11805, 10314,  9122,  8265,  7559}, // Q5s
+    {33985, 22259, 16776, 13549, 11547, 10111,  8977,  8144,  7396}, // Q4s
+    {33438, 21741, 16294, 13243, 11260,  9876,  8791,  8002,  7324}, // Q3s
+    {32886, 21220, 15930, 12871, 10995,  9648,  8637,  7819,  7224}, // Q2s
+    {41627, 29789, 23128, 18902, 15952, 13760, 11971, 10575,  9353}, // AJo
+    {39670, 28252, 22067, 18170, 15412, 13294, 11619, 10273,  9166}, // KJo
+    {38085, 27065, 21288, 17636, 15029, 12927, 11368, 10063,  9016}, // QJo
+    {50795, 40087, 32274, 26388, 21980, 18650, 16162, 14187, 12674}, // JJ
+    {37727, 27462, 22217, 18743, 16310, 14428, 12963, 11788, 10819}, // JTs
+    {36464, 25844, 20453, 17046, 14628, 12867, 11478, 10429,  9555}, // J9s
+    {35442, 24482, 19072, 15689, 13447, 11754, 10517,  9462,  8681}, // J8s
+    {34233, 23149, 17776, 14526, 12348, 10728,  9508,  8576,  7875}, // J7s
+    {33068, 21855, 16581, 13351, 11322,  9835,  8754,  7916,  7227}, // J6s
+    {32801, 21429, 16155, 13045, 11077,  9589,  8553,  7688,  7094}, // J5s
+    {32165, 20971, 15745, 12751, 10774,  9397,  8360,  7556,  6899}, // J4s
+    {31630, 20393, 15317, 12446, 10499,  9203,  8240,  7455,  6858}, // J3s
+    {31009, 19929, 14882, 12086, 10273,  8980,  8059,  7346,  6701}, // J2s
+    {41119, 28979, 22242, 18030, 15090, 12969, 11220,  9863,  8745}, // ATo
+    {39172, 27419, 21283, 17339, 14559, 12493, 10942,  9633,  8603}, // KTo
+    {37552, 26344, 20541, 16792, 14216, 12173, 10635,  9477,  8454}, // QTo
+    {36280, 25631, 20101, 16618, 14073, 12169, 10690,  9507,  8571}, // JTo
+    {49165, 37736, 29578, 23818, 19581, 16487, 14282, 12533, 11213}, // TT
+    {35384, 25386, 20233, 16976, 14675, 12926, 11598, 10579,  9760}, // T9s
+    {34344, 23983, 18931, 15707, 13533, 11852, 10621,  9650,  8876}, // T8s
+    {33214, 22762, 17624, 14518, 12410, 10878,  9689,  8821,  8088}, // T7s
+    {32091, 21404, 16357, 13410, 11381,  9869,  8854,  7998,  7320}, // T6s
+    {30960, 20189, 15220, 12307, 10427,  9120,  8130,  7344,  6725}, // T5s
+    {30483, 19819, 14887, 12055, 10224,  8939,  7933,  7172,  6605}, // T4s
+    {30006, 19282, 14478, 11790,  9981,  8717,  7780,  7074,  6466}, // T3s
+    {29350, 18815, 14082, 11434,  9739,  8534,  7652,  6926,  6362}, // T2s
+    {39852, 27268, 20360, 16089, 13249, 11161,  9588,  8347,  7298}, // A9o
+    {37935, 25725, 19304, 15422, 12728, 10747,  9299,  8036,  7100}, // K9o
+    {36233, 24575, 18639, 14935, 12423, 10480,  9038,  7856,  7003}, // Q9o
+    {34922, 23819, 18270, 14757, 12309, 10451,  9067,  7947,  7134}, // J9o
+    {33784, 23362, 18089, 14777, 12332, 10599,  9312,  8217,  7410}, // T9o
+    {47216, 35162, 26995, 21375, 17430, 14703, 12726, 11276, 10166}, // 99
+    {33282, 23565, 18620, 15503, 13274, 11629, 10460,  9491,  8785}, // 98s
+    {32205, 22301, 17473, 14489, 12297, 10889,  9732,  8898,  8183}, // 97s
+    {31033, 21075, 16303, 13323, 11362,  9965,  8918,  8125,  7453}, // 96s
+    {30016, 19806, 15048, 12298, 10435,  9130,  8097,  7377,  6776}, // 95s
+    {28765, 18567, 13970, 11368,  9596,  8325,  7458,  6729,  6163}, // 94s
+    {28350, 18234, 13689, 11065,  9328,  8183,  7278,  6611,  6044}, // 93s
+    {27837, 17755, 13226, 10724,  9137,  8023,  7180,  6520,  5966}, // 92s
+    {39221, 26495, 19561, 15407, 12613, 10580,  9060,  7842,  6836}, // A8o
+    {36722, 24173, 17758, 14020, 11376,  9592,  8119,  7039,  6167}, // K8o
+    {35091, 23163, 17081, 13448, 11071,  9271,  7958,  6894,  6065}, // Q8o
+    {33761, 22369, 16773, 13337, 10978,  9231,  7941,  6971,  6184}, // J8o
+    {32551, 21905, 16608, 13355, 11078,  9449,  8204,  7226,  6480}, // T8o
+    {31536, 21435, 16311, 13130, 10881,  9271,  8084,  7165,  6436}, // 98o
+    {45328, 32766, 24615, 19285, 15771, 13328, 11600, 10400,  9490}, // 88
+    {31411, 22150, 17434, 14466, 12414, 10911,  9894,  9026,  8338}, // 87s
+    {30362, 20993, 16296, 13548, 11569, 10226,  9200,  8395,  7749}, // 86s
+    {29186, 19683, 15172, 12443, 10666,  9353,  8385,  7669,  7109}, // 85s
+    {27981, 18476, 14031, 11414,  9735,  8560,  7718,  6980,  6441}, // 84s
+    {26797, 17223, 12981, 10499,  8927,  7799,  7034,  6339,  5841}, // 83s
+    {26377, 16906, 12655, 10291,  8761,  7647,  6851,  6239,  5724}, // 82s
+    {38509, 25751, 18898, 14717, 11981, 10080,  8556,  7443,  6510}, // A7o
+    {36151, 23597, 17217, 13386, 10917,  9086,  7728,  6660,  5872}, // K7o
+    {33945, 21710, 15703, 12154,  9895,  8187,  6963,  6002,  5249}, // Q7o
+    {32584, 20916, 15368, 11981,  9741,  8122,  6952,  6050,  5330}, // J7o
+    {31365, 20502, 15261, 12061,  9892,  8323,  7149,  6306,  5623}, // T7o
+    {30316, 20151, 15092, 11980,  9862,  8391,  7265,  6438,  5821}, // 97o
+    {29498, 19941, 15101, 12025, 10003,  8532,  7502,  6699,  6008}, // 87o
+    {43396, 30343, 22558, 17492, 14329, 12189, 10754,  9727,  8947}, // 77
+    {29750, 20909, 16393, 13631, 11685, 10388,  9416,  8650,  8029}, // 76s
+    {28665, 19667, 15335, 12719, 10975,  9701,  8831,  8091,  7508}, // 75s
+    {27422, 18531, 14254, 11734, 10031,  8895,  8035,  7362,  6820}, // 74s
+    {26217, 17318, 13133, 10703,  9192,  8097,  7260,  6630,  6136}, // 73s
+    {25058, 16119, 12133,  9810,  8344,  7358,  6631,  6096,  5606}, // 72s
+    {37832, 24827, 18013, 14028, 11384,  9598,  8210,  7150,  6247}, // A6o
+    {35510, 22872, 16549, 12848, 10444,  8725,  7418,  6360,  5613}, // K6o
+    {33464, 21082, 15147, 11745,  9487,  7816,  6647,  5727,  5029}, // Q6o
+    {31307, 19504, 14013, 10806,  8678,  7150,  6108,  5250,  4606}, // J6o
+    {30188, 19053, 13882, 10836,  8726,  7348,  6252,  5451,  4842}, // T6o
+    {29178, 18715, 13770, 10816,  8822,  7416,  6428,  5670,  5043}, // 96o
+    {28307, 18627, 13935, 11028,  9056,  7760,  6745,  6049,  5421}, // 86o
+    {27769, 18638, 14043, 11198,  9248,  7948,  7034,  6285,  5738}, // 76o
+    {41519, 28321, 20625, 16024, 13190, 11311, 10056,  9130,  8563}, // 66
+    {28278, 19852, 15552, 12916, 11209,  9934,  9075,  8333,  7792}, // 65s
+    {27088, 18633, 14511, 11999, 10401,  9278,  8410,  7802,  7274}, // 64s
+    {25866, 17440, 13443, 11037,  9580,  8490,  7695,  7115,  6587}, // 63s
+    {24691, 16251, 12328, 10057,  8697,  7738,  6974,  6391,  5915}, // 62s
+    {37769, 25025, 18346, 14415, 11800,  9999,  8601,  7534,  6625}, // A5o
+    {34917, 22256, 15972, 12348, 10049,  8361,  7165,  6174,  5395}, // K5o
+    {32834, 20432, 14641, 11292,  9089,  7569,  6394,  5521,  4834}, // Q5o
+    {30923, 19049, 13600, 10406,  8383,  6909,  5879,  5063,  4435}, // J5o
+    {28960, 17748, 12607,  9694,  7796,  6454,  5489,  4769,  4187}, // T5o
+    {27999, 17374, 12524,  9652,  7815,  6504,  5573,  4860,  4306}, // 95o
+    {27171, 17289, 12686,  9916,  8076,  6832,  5937,  5249,  4729}, // 85o
+    {26576, 17358, 12857, 10178,  8394,  7209,  6379,  5674,  5184}, // 75o
+    {26192, 17522, 13087, 10394,  8692,  7479,  6656,  6012,  5529}, // 65o
+    {39530, 26246, 18960, 14686, 12150, 10508,  9440,  8721,  8140}, // 55
+    {27158, 18991, 14913, 12343, 10785,  9683,  8849,  8173,  7659}, // 54s
+    {26027, 17849, 13862, 11574, 10054,  8991,  8250,  7616,  7100}, // 53s
+    {24839, 16683, 12824, 10596,  9204,  8219,  7501,  6942,  6451}, // 52s
+    {37218, 24383, 17834, 13939, 11484,  9670,  8334,  7333,  6500}, // A4o
+    {34303, 21603, 15490, 11943,  9671,  8073,  6886,  6009,  5216}, // K4o
+    {32168, 19907, 14120, 10828,  8717,  7254,  6179,  5336,  4707}, // Q4o
+    {30311, 18511, 13101, 10048,  8068,  6649,  5669,  4881,  4278}, // J4o
+    {28505, 17285, 12260,  9382,  7484,  6267,  5309,  4548,  4020}, // T4o
+    {26645, 16024, 11320,  8592,  6876,  5699,  4810,  4179,  3661}, // 94o
+    {25785, 15949, 11468,  8824,  7104,  5889,  5111,  4479,  3970}, // 84o
+    {25234, 15991, 11642,  9121,  7464,  6304,  5518,  4916,  4471}, // 74o
+    {24939, 16241, 11976,  9450,  7846,  6777,  5987,  5424,  4957}, // 64o
+    {25018, 16646, 12341,  9918,  8294,  7229,  6451,  5847,  5366}, // 54o
+    {37410, 24089, 17212, 13459, 11343,  9953,  9087,  8478,  7953}, // 44
+    {25339, 17330, 13359, 11072,  9634,  8665,  7913,  7297,  6773}, // 43s
+    {24141, 16176, 12386, 10251,  8941,  7973,  7334,  6695,  6269}, // 42s
+    {36603, 23802, 17262, 13514, 11111,  9371,  8075,  7085,  6309}, // A3o
+    {33712, 20978, 14934, 11526,  9372,  7857,  6714,  5841,  5136}, // K3o
+    {31576, 19339, 13664, 10452,  8499,  7039,  5969,  5205,  4582}, // Q3o
+    {29642, 17917, 12608,  9654,  7780,  6415,  5477,  4755,  4158}, // J3o
+    {27910, 16762, 11824,  8999,  7228,  5992,  5104,  4419,  3859}, // T3o
+    {26274, 15690, 11010,  8311,  6615,  5468,  4640,  3983,  3539}, // 93o
+    {24582, 14709, 10259,  7799,  6219,  5162,  4401,  3804,  3374}, // 83o
+    {23999, 14723, 10494,  8081,  6462,  5511,  4753,  4185,  3742}, // 73o
+    {23590, 14933, 10787,  8390,  6920,  5906,  5227,  4687,  4245}, // 63o
+    {23783, 15415, 11283,  8925,  7450,  6514,  5797,  5259,  4806}, // 53o
+    {23003, 14756, 10762,  8457,  7059,  6109,  5410,  4925,  4495}, // 43o
+    {35208, 22030, 15699, 12441, 10665,  9540,  8803,  8280,  7873}, // 33
+    {23591, 15610, 11914,  9846,  8573,  7696,  6988,  6486,  6007}, // 32s
+    {36000, 23097, 16690, 12975, 10669,  9006,  7775,  6806,  6019}, // A2o
+    {33069, 20408, 14476, 11194,  9048,  7590,  6549,  5685,  5034}, // K2o
+    {30957, 18763, 13213, 10114,  8183,  6830,  5829,  5098,  4433}, // Q2o
+    {29092, 17336, 12157,  9289,  7491,  6241,  5357,  4609,  4045}, // J2o
+    {27308, 16216, 11357,  8692,  6939,  5800,  4958,  4315,  3805}, // T2o
+    {25620, 15138, 10556,  7994,  6342,  5258,  4484,  3850,  3455}, // 92o
+    {24139, 14267,  9916,  7505,  6012,  4942,  4237,  3672,  3233}, // 82o
+    {22644, 13397,  9349,  7058,  5628,  4693,  4041,  3531,  3143}, // 72o
+    {22351, 13589,  9595,  7371,  5990,  5055,  4408,  3920,  3539}, // 62o
+    {22396, 14098, 10135,  7916,  6587,  5654,  5018,  4485,  4114}, // 52o
+    {21697, 13529,  9698,  7548,  6247,  5399,  4819,  4347,  3940}, // 42o
+    {21200, 12930,  9197,  7095,  5912,  5058,  4463,  4001,  3645}, // 32o
+    {33001, 20098, 14338, 11642, 10168,  9278,  8696,  8178,  7809}, // 22
+};
\ No newline at end of file
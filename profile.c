@@ -0,0 +1,154 @@
+#include "profile.h"
+#include <stdatomic.h>
+#include <stdio.h>
+
+// Only the probes themselves vanish without HOLDEM_PROFILE; the report
+// functions stay callable and report nothing recorded
+
+typedef struct {
+    _Atomic uint32_t min_inverted; // ~min, so that zero-initialized means "none yet"
+    _Atomic uint32_t max;
+    _Atomic uint32_t buckets[PROFILE_BUCKETS];
+} ProfileHistogram;
+
+#ifdef HOLDEM_PROFILE
+static ProfileHistogram profile_histograms[PROFILE_PROBE_COUNT];
+#endif
+
+static const char* profile_names[PROFILE_PROBE_COUNT] = {
+    "evaluate", "ai_decide", "new_hand", "action", "render"};
+
+// Values below 4 get a bucket each; above, a power of two is split in four
+static uint8_t profile_bucket(uint32_t cycles) {
+    if(cycles < 4) return (uint8_t)cycles;
+    uint8_t msb = 31 - __builtin_clz(cycles);
+    return (uint8_t)(msb * 4 - 4 + ((cycles >> (msb - 2)) & 3));
+}
+
+// Largest value that lands in a bucket
+static uint32_t profile_bucket_top(uint8_t bucket) {
+    if(bucket < 4) return bucket;
+    uint8_t msb = bucket / 4 + 1;
+    uint32_t low = (uint32_t)(4 + bucket % 4) << (msb - 2);
+    return low + ((1u << (msb - 2)) - 1);
+}
+
+#ifdef HOLDEM_PROFILE
+void profile_record(ProfileProbe probe, uint32_t cycles) {
+    ProfileHistogram* histogram = &profile_histograms[probe];
+
+    // Relaxed: the counters are independent tallies, read when reporting
+    atomic_fetch_add_explicit(&histogram->buckets[profile_bucket(cycles)], 1, memory_order_relaxed);
+
+    uint32_t inverted = ~cycles;
+    uint32_t seen = atomic_load_explicit(&histogram->min_inverted, memory_order_relaxed);
+    while(inverted > seen &&
+          !atomic_compare_exchange_weak_explicit(
+              &histogram->min_inverted, &seen, inverted, memory_order_relaxed, memory_order_relaxed)) {
+    }
+    seen = atomic_load_explicit(&histogram->max, memory_order_relaxed);
+    while(cycles > seen &&
+          !atomic_compare_exchange_weak_explicit(
+              &histogram->max, &seen, cycles, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+#endif
+
+void profile_summary(ProfileProbe probe, ProfileSummary* summary) {
+    summary->count = summary->min = summary->p50 = summary->p99 = summary->max = 0;
+#ifdef HOLDEM_PROFILE
+    ProfileHistogram* histogram = &profile_histograms[probe];
+    uint32_t buckets[PROFILE_BUCKETS];
+    uint32_t total = 0;
+
+    // Probes keep firing while we read; quantiles come from this copy
+    for(uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+        buckets[i] = atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+        total += buckets[i];
+    }
+    if(total == 0) return;
+
+    summary->count = total;
+    summary->min = ~atomic_load_explicit(&histogram->min_inverted, memory_order_relaxed);
+    summary->max = atomic_load_explicit(&histogram->max, memory_order_relaxed);
+
+    uint32_t seen = 0;
+    uint32_t p50_rank = total - total / 2; // Ceiling of half
+    uint32_t p99_rank = total - total / 100;
+    for(uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+        if(buckets[i] == 0) continue;
+        seen += buckets[i];
+        uint32_t top = profile_bucket_top(i);
+        if(top > summary->max) top = summary->max;
+        if(summary->p50 == 0 && seen >= p50_rank) summary->p50 = top;
+        if(summary->p99 == 0 && seen >= p99_rank) {
+            summary->p99 = top;
+            break;
+        }
+    }
+#else
+    (void)probe;
+    (void)profile_bucket;
+    (void)profile_bucket_top;
+#endif
+}
+
+void profile_reset(void) {
+#ifdef HOLDEM_PROFILE
+    for(uint8_t p = 0; p < PROFILE_PROBE_COUNT; p++) {
+        ProfileHistogram* histogram = &profile_histograms[p];
+        atomic_store(&histogram->min_inverted, 0);
+        atomic_store(&histogram->max, 0);
+        for(uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+            atomic_store(&histogram->buckets[i], 0);
+        }
+    }
+#endif
+}
+
+const char* profile_probe_name(ProfileProbe probe) {
+    return probe < PROFILE_PROBE_COUNT ? profile_names[probe] : "?";
+}
+
+// The device counts core cycles at a fixed clock. On the host the counter
+// (TSC or nanoseconds) is calibrated against the wall clock once.
+uint32_t profile_cycles_per_us(void) {
+#ifdef HOLDEM_HOST
+    static uint32_t cycles_per_us = 0;
+    if(cycles_per_us == 0) {
+        uint64_t start_us = platform_time_us();
+        uint32_t start = platform_cycles();
+        while(platform_time_us() - start_us < 10000) {
+        }
+        uint32_t per_us = (platform_cycles() - start) / (uint32_t)(platform_time_us() - start_us);
+        cycles_per_us = per_us ? per_us : 1;
+    }
+    return cycles_per_us;
+#else
+    return furi_hal_cortex_instructions_per_microsecond();
+#endif
+}
+
+// One line per probe with recorded samples: count, then min, p50, p99 and
+// max in microseconds. Returns the length written (snprintf semantics).
+size_t profile_report(char* buffer, size_t size) {
+    double per_us = profile_cycles_per_us();
+    size_t length = snprintf(buffer, size, "probe         count      min      p50      p99      max (us)\n");
+
+    for(uint8_t p = 0; p < PROFILE_PROBE_COUNT; p++) {
+        ProfileSummary summary;
+        profile_summary((ProfileProbe)p, &summary);
+        if(summary.count == 0) continue;
+        length += snprintf(
+            length < size ? buffer + length : NULL,
+            length < size ? size - length : 0,
+            "%-10s %8lu %8.2f %8.2f %8.2f %8.2f\n",
+            profile_names[p],
+            (unsigned long)summary.count,
+            summary.min / per_us,
+            summary.p50 / per_us,
+            summary.p99 / per_us,
+            summary.max / per_us);
+    }
+    return length;
+}
\ No newline at end of file
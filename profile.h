@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+
+// Scoped cycle-count probes on hot paths. Build with HOLDEM_PROFILE to
+// enable them (host: make PROFILE=1, device: cdefines in application.fam);
+// otherwise PROFILE_SCOPE expands to nothing and none of this is linked in.
+// Durations go into fixed log-scale histograms in static memory, so
+// recording never allocates and quantiles come out of a few hundred bytes
+// per probe. Probes may fire from any thread.
+
+typedef enum {
+    PROFILE_EVALUATE = 0, // poker_evaluate_set (and poker_evaluate_hand)
+    PROFILE_AI_DECIDE, // ai_decide, including AI_HARD's search
+    PROFILE_ENGINE_NEW_HAND, // engine_new_hand
+    PROFILE_ENGINE_ACTION, // engine_apply_action, including street changes
+    PROFILE_RENDER, // The app's render callback
+    PROFILE_PROBE_COUNT
+} ProfileProbe;
+
+// Four buckets per power of two: values are kept to within 25%
+#define PROFILE_BUCKETS 128
+
+typedef struct {
+    uint32_t count;
+    uint32_t min; // Cycles
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+} ProfileSummary;
+
+#ifdef HOLDEM_PROFILE
+
+typedef struct {
+    uint8_t probe;
+    uint32_t start;
+} ProfileScope;
+
+void profile_record(ProfileProbe probe, uint32_t cycles);
+
+static inline ProfileScope profile_scope_begin(ProfileProbe probe) {
+    return (ProfileScope){probe, platform_cycles()};
+}
+
+static inline void profile_scope_end(ProfileScope* scope) {
+    profile_record((ProfileProbe)scope->probe, platform_cycles() - scope->start);
+}
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+// Times the rest of the enclosing block
+#define PROFILE_SCOPE(probe)                                                      \
+    ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)                         \
+        __attribute__((cleanup(profile_scope_end))) = profile_scope_begin(probe)
+
+#else
+
+#define PROFILE_SCOPE(probe) ((void)0)
+
+#endif
+
+// Function declarations
+void profile_summary(ProfileProbe probe, ProfileSummary* summary);
+void profile_reset(void);
+const char* profile_probe_name(ProfileProbe probe);
+uint32_t profile_cycles_per_us(void);
+size_t profile_report(char* buffer, size_t size);
\ No newline at end of file
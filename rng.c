@@ -0,0 +1,53 @@
+#include "rng.h"
+
+// SplitMix64 finalizer, used to spread user seeds over the state space
+static uint64_t rng_mix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+void rng_seed(Rng* rng, uint64_t seed, uint64_t stream) {
+    rng->state = 0;
+    rng->inc = (stream << 1) | 1;
+    rng_next(rng);
+    rng->state += rng_mix(seed);
+    rng_next(rng);
+}
+
+// Streams are derived from (hand number, purpose) so that the deal of a hand
+// only depends on the session seed and the hand number, never on how many
+// random numbers the AI consumed in earlier hands
+void rng_seed_hand(Rng* rng, uint64_t seed, uint32_t hand_number, uint8_t purpose) {
+    rng_seed(rng, seed, ((uint64_t)hand_number << 8) | purpose);
+}
+
+// Jump ahead by delta steps in O(log delta) (Brown, "Random Number
+// Generation with Arbitrary Strides")
+void rng_advance(Rng* rng, uint64_t delta) {
+    uint64_t cur_mult = RNG_MULTIPLIER;
+    uint64_t cur_plus = rng->inc;
+    uint64_t acc_mult = 1;
+    uint64_t acc_plus = 0;
+
+    while(delta > 0) {
+        if(delta & 1) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1) * cur_plus;
+        cur_mult *= cur_mult;
+        delta >>= 1;
+    }
+
+    rng->state = acc_mult * rng->state + acc_plus;
+}
+
+// Derive an independent generator (new stream and state) from a parent,
+// e.g. one per simulator worker thread
+void rng_split(Rng* parent, Rng* child) {
+    uint64_t seed = ((uint64_t)rng_next(parent) << 32) | rng_next(parent);
+    uint64_t stream = ((uint64_t)rng_next(parent) << 32) | rng_next(parent);
+    rng_seed(child, seed, stream);
+}
\ No newline at end of file
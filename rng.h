@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+// PCG32 (XSH-RR) random number generator. Small (16 bytes), fast on both the
+// Cortex-M4 and the host, and with no hidden global state: every caller owns
+// its Rng. The increment selects one of 2^63 independent streams, so
+// simulator workers and individual hands each get their own sequence.
+typedef struct {
+    uint64_t state;
+    uint64_t inc; // Stream selector, always odd
+} Rng;
+
+#define RNG_MULTIPLIER 6364136223846793005ULL
+
+static inline uint32_t rng_next(Rng* rng) {
+    uint64_t old = rng->state;
+    rng->state = old * RNG_MULTIPLIER + rng->inc;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+// Uniform integer in [0, bound) without modulo bias (Lemire's method)
+static inline uint32_t rng_bounded(Rng* rng, uint32_t bound) {
+    uint64_t product = (uint64_t)rng_next(rng) * bound;
+    uint32_t low = (uint32_t)product;
+    if(low < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        while(low < threshold) {
+            product = (uint64_t)rng_next(rng) * bound;
+            low = (uint32_t)product;
+        }
+    }
+    return (uint32_t)(product >> 32);
+}
+
+// Uniform float in [0, 1)
+static inline float rng_float(Rng* rng) {
+    return (rng_next(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+// Function declarations
+void rng_seed(Rng* rng, uint64_t seed, uint64_t stream);
+void rng_seed_hand(Rng* rng, uint64_t seed, uint32_t hand_number, uint8_t purpose);
+void rng_advance(Rng* rng, uint64_t delta);
+void rng_split(Rng* parent, Rng* child);
\ No newline at end of file
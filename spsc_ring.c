@@ -0,0 +1,33 @@
+#include "spsc_ring.h"
+#include <string.h>
+
+void spsc_ring_init(SpscRing* ring, void* items, uint32_t item_size, uint32_t capacity) {
+    ring->items = items;
+    ring->item_size = item_size;
+    ring->mask = capacity - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+}
+
+// Producer side. Each index is only written by its own side, so the only
+// ordering needed is release on publish and acquire on observe.
+bool spsc_ring_push(SpscRing* ring, const void* item) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if(tail - head > ring->mask) return false;
+
+    memcpy(ring->items + (tail & ring->mask) * ring->item_size, item, ring->item_size);
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+// Consumer side
+bool spsc_ring_pop(SpscRing* ring, void* item) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if(head == tail) return false;
+
+    memcpy(item, ring->items + (head & ring->mask) * ring->item_size, ring->item_size);
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread (e.g. the GUI input callback feeding the app thread). Items are
+// copied in and out by value; push fails instead of blocking when full.
+// Capacity must be a power of two.
+typedef struct {
+    uint8_t* items;
+    uint32_t item_size;
+    uint32_t mask; // capacity - 1
+    _Atomic uint32_t head; // Next slot to read, written by the consumer
+    _Atomic uint32_t tail; // Next slot to write, written by the producer
+} SpscRing;
+
+// Function declarations
+void spsc_ring_init(SpscRing* ring, void* items, uint32_t item_size, uint32_t capacity);
+bool spsc_ring_push(SpscRing* ring, const void* item);
+bool spsc_ring_pop(SpscRing* ring, void* item);
\ No newline at end of file
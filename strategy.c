@@ -0,0 +1,126 @@
+#include "strategy.h"
+#include "preflop.h"
+
+// EHS bucket tables per street (strategy_set_buckets), NULL for the built-in buckets
+static const BucketTable* strategy_tables;
+
+// Heads-up preflop equity (of 65535) that starts each bucket above the first
+static const uint16_t strategy_preflop_bounds[STRATEGY_BUCKETS - 1] = {
+    22938, 26214, 29491, 32768, 36045, 40632, 45875};
+
+// Plays and trains with EHS bucket tables (buckets.h), one per street
+// (preflop, flop, turn, river); NULL goes back to the built-in buckets. A
+// strategy table only makes sense with the buckets it was trained on.
+void strategy_set_buckets(const BucketTable* tables) {
+    strategy_tables = tables;
+}
+
+// Strength bucket of a hand: from the EHS tables when set, else preflop by
+// heads-up starting-hand equity and after the flop by made-hand category
+// (high card, pair, ... quads and better)
+uint8_t strategy_bucket(CardSet hole, CardSet board) {
+    if(strategy_tables) {
+        uint8_t cards = poker_set_count(board);
+        const BucketTable* table = &strategy_tables[cards ? cards - 2 : 0];
+        uint8_t bucket = buckets_lookup(table, hole, board);
+        if(bucket != BUCKETS_NONE) return bucket * STRATEGY_BUCKETS / table->header.buckets;
+    }
+
+    if(board == 0) {
+        uint16_t equity = preflop_equity_table[preflop_class(hole)][0];
+        uint8_t bucket = 0;
+        while(bucket < STRATEGY_BUCKETS - 1 && equity >= strategy_preflop_bounds[bucket]) {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    HandRank rank = poker_hand_category(poker_hand_rank_u16(hole | board));
+    return rank < STRATEGY_BUCKETS ? (uint8_t)rank : STRATEGY_BUCKETS - 1;
+}
+
+// Information set of `seat` (the player to act) holding a hand of `bucket`
+uint16_t strategy_infoset(GameState* game, uint8_t seat, uint8_t bucket) {
+    Player* player = &game->players[seat];
+    uint8_t street = game->phase < PHASE_SHOWDOWN ? game->phase : PHASE_RIVER;
+    uint8_t position = (seat + MAX_PLAYERS - game->dealer) % MAX_PLAYERS;
+    uint8_t players = game->active_players > 1 ? game->active_players - 2 : 0;
+
+    uint32_t in_pot = game->pot;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        in_pot += game->players[i].bet;
+    }
+    // Measured against the pot before the bet being faced: in_pot already
+    // holds that bet, so to_call could never exceed it
+    uint32_t to_call = game->current_bet - player->bet;
+    uint32_t pot_before = in_pot - to_call;
+    uint8_t level = 3;
+    if(to_call == 0) {
+        level = 0;
+    } else if(to_call * 2 <= pot_before) {
+        level = 1;
+    } else if(to_call <= pot_before) {
+        level = 2;
+    }
+
+    uint16_t infoset = street;
+    infoset = infoset * MAX_PLAYERS + position;
+    infoset = infoset * (MAX_PLAYERS - 1) + players;
+    infoset = infoset * STRATEGY_BET_LEVELS + level;
+    return infoset * STRATEGY_BUCKETS + bucket;
+}
+
+// Concrete action for every abstract one, returns the mask of the legal
+// ones. Raise sizes follow engine_legal_actions: a size that comes out no
+// bigger than the one before it (short stacks) is left out.
+uint8_t strategy_actions(GameState* game, Action* actions) {
+    Player* player = &game->players[game->current_player];
+    uint32_t call_amount = game->current_bet - player->bet;
+    uint32_t max_raise = player->bet + player->chips;
+    uint8_t legal = 1 << STRATEGY_CALL;
+
+    actions[STRATEGY_FOLD] = (Action){ACTION_FOLD, 0};
+    actions[STRATEGY_CALL] = (Action){call_amount > 0 ? ACTION_CALL : ACTION_CHECK, 0};
+    if(call_amount > 0) legal |= 1 << STRATEGY_FOLD;
+
+    uint32_t in_pot = game->pot;
+    for(uint8_t i = 0; i < MAX_PLAYERS; i++) {
+        in_pot += game->players[i].bet;
+    }
+    uint32_t sizes[3] = {engine_min_raise_to(game), game->current_bet + in_pot + call_amount, max_raise};
+
+    uint32_t last = game->current_bet;
+    for(uint8_t i = 0; i < 3; i++) {
+        uint32_t raise_to = sizes[i] < max_raise ? sizes[i] : max_raise;
+        actions[STRATEGY_RAISE_MIN + i] = (Action){ACTION_RAISE, raise_to};
+        if(raise_to > last) {
+            legal |= 1 << (STRATEGY_RAISE_MIN + i);
+            last = raise_to;
+        }
+    }
+    return legal;
+}
+
+// Samples the table's action for `seat`, the player to act. Information
+// sets the trainer never reached have no weights: check or call.
+Action strategy_decide(GameState* game, uint8_t seat, Rng* rng) {
+    Player* player = &game->players[seat];
+    Action actions[STRATEGY_ACTIONS];
+    uint8_t legal = strategy_actions(game, actions);
+    uint16_t infoset = strategy_infoset(game, seat, strategy_bucket(player->hand_set, game->community_set));
+
+    uint8_t weights[STRATEGY_ACTIONS];
+    uint16_t total = 0;
+    for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+        weights[a] = legal & (1 << a) ? strategy_weight(infoset, (StrategyAction)a) : 0;
+        total += weights[a];
+    }
+    if(total == 0) return actions[STRATEGY_CALL];
+
+    uint16_t pick = (uint16_t)rng_bounded(rng, total);
+    for(uint8_t a = 0; a < STRATEGY_ACTIONS; a++) {
+        if(pick < weights[a]) return actions[a];
+        pick -= weights[a];
+    }
+    return actions[STRATEGY_CALL];
+}
\ No newline at end of file
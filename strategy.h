@@ -0,0 +1,47 @@
+#pragma once
+
+#include "buckets.h"
+#include "engine.h"
+
+// Abstracted game for the trained strategy (AI_STRATEGY personality). A
+// decision is reduced to an information set of
+//   street x position from the dealer x players in the hand x bet level x card bucket
+// and one of five abstract actions. Card buckets group hands of similar
+// strength: the preflop equity class before the flop, the made-hand
+// category after it. Host tools can load holdem-buckets EHS tables instead
+// (strategy_set_buckets, -B). The trainer (host/holdem_cfr.c, MCCFR) and
+// the bot share these functions, so they always agree on the abstraction.
+//
+// The table itself lives in strategy_table.c, generated by holdem-cfr
+// (make -C host strategy-table): per information set, a 4-bit weight per
+// action, two actions to a byte.
+
+typedef enum {
+    STRATEGY_FOLD = 0,
+    STRATEGY_CALL, // Check or call
+    STRATEGY_RAISE_MIN,
+    STRATEGY_RAISE_POT,
+    STRATEGY_ALL_IN,
+    STRATEGY_ACTIONS
+} StrategyAction;
+
+// Bet levels: nothing to call, up to half the pot, up to the pot, more
+// (the pot before the bet being called)
+#define STRATEGY_BET_LEVELS 4
+#define STRATEGY_BUCKETS 8
+#define STRATEGY_INFOSETS (4 * MAX_PLAYERS * (MAX_PLAYERS - 1) * STRATEGY_BET_LEVELS * STRATEGY_BUCKETS)
+#define STRATEGY_TABLE_BYTES ((STRATEGY_ACTIONS + 1) / 2)
+#define STRATEGY_WEIGHT_MAX 15
+
+extern const uint8_t strategy_table[STRATEGY_INFOSETS][STRATEGY_TABLE_BYTES];
+
+static inline uint8_t strategy_weight(uint16_t infoset, StrategyAction action) {
+    return (strategy_table[infoset][action / 2] >> (action % 2 * 4)) & 0x0F;
+}
+
+// Function declarations
+void strategy_set_buckets(const BucketTable* tables);
+uint8_t strategy_bucket(CardSet hole, CardSet board);
+uint16_t strategy_infoset(GameState* game, uint8_t seat, uint8_t bucket);
+uint8_t strategy_actions(GameState* game, Action* actions);
+Action strategy_decide(GameState* game, uint8_t seat, Rng* rng);
\ No newline at end of file
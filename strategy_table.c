@@ -0,0 +1,199 @@
+// Generated by host/holdem_cfr.c (4760320 iterations, seed 1),
+// do not edit. Regenerate with: make -C host strategy-table
+
+#include "strategy.h"
+
+const uint8_t strategy_table[STRATEGY_INFOSETS][STRATEGY_TABLE_BYTES] = {
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 0 after dealer, 2 players, bet level 0
+    {0x62, 0x60, 0x00}, {0x0e, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xe0, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xd1, 0x00, 0x00}, {0xd0, 0x20, 0x00}, {0xe0, 0x00, 0x00}, // preflop, seat 0 after dealer, 2 players, bet level 1
+    {0x5a, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0xc3, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x87, 0x00, 0x00}, {0xa3, 0x11, 0x00}, {0xa2, 0x30, 0x00}, {0xd1, 0x10, 0x00}, // preflop, seat 0 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x87, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 0 after dealer, 2 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 0 after dealer, 3 players, bet level 0
+    {0x0f, 0x00, 0x00}, {0x3b, 0x00, 0x00}, {0x1c, 0x11, 0x00}, {0xa5, 0x00, 0x01}, {0xd2, 0x00, 0x00}, {0xa1, 0x22, 0x00}, {0x90, 0x51, 0x00}, {0xb1, 0x21, 0x00}, // preflop, seat 0 after dealer, 3 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x5a, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x74, 0x22, 0x00}, {0xb2, 0x10, 0x00}, // preflop, seat 0 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0c, 0x12, 0x00}, {0x11, 0x39, 0x00}, {0x80, 0x43, 0x00}, {0x40, 0x37, 0x00}, // preflop, seat 0 after dealer, 3 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 0 after dealer, 4 players, bet level 0
+    {0x0b, 0x03, 0x00}, {0x1d, 0x00, 0x00}, {0x0d, 0x11, 0x00}, {0xe1, 0x00, 0x00}, {0x1d, 0x00, 0x01}, {0x2c, 0x00, 0x00}, {0xe0, 0x00, 0x00}, {0xe0, 0x00, 0x00}, // preflop, seat 0 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0x40, 0x92, 0x00}, {0x40, 0xa0, 0x00}, // preflop, seat 0 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1c, 0x11, 0x00}, {0x22, 0x90, 0x00}, {0x51, 0x30, 0x06}, // preflop, seat 0 after dealer, 4 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 1 after dealer, 2 players, bet level 0
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x16, 0x51, 0x03}, {0xe0, 0x10, 0x00}, {0xe0, 0x01, 0x00}, {0xe0, 0x10, 0x00}, {0xe0, 0x11, 0x00}, {0x91, 0x32, 0x00}, // preflop, seat 1 after dealer, 2 players, bet level 1
+    {0x0e, 0x00, 0x00}, {0x0d, 0x01, 0x00}, {0x0f, 0x00, 0x00}, {0x0e, 0x01, 0x00}, {0x0b, 0x04, 0x00}, {0xb1, 0x04, 0x00}, {0x80, 0x61, 0x00}, {0xa1, 0x40, 0x00}, // preflop, seat 1 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 1 after dealer, 2 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 1 after dealer, 3 players, bet level 0
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x21, 0x00}, {0x51, 0x20, 0x07}, // preflop, seat 1 after dealer, 3 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x14, 0x0a, 0x00}, {0x61, 0x02, 0x06}, {0x50, 0x36, 0x01}, // preflop, seat 1 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x44, 0x00, 0x06}, {0x81, 0x10, 0x04}, // preflop, seat 1 after dealer, 3 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 1 after dealer, 4 players, bet level 0
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1c, 0x02, 0x00}, {0x90, 0x23, 0x00}, {0x70, 0x70, 0x01}, // preflop, seat 1 after dealer, 4 players, bet level 1
+    {0x2d, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x49, 0x02, 0x00}, {0xe0, 0x10, 0x01}, // preflop, seat 1 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x83, 0x00, 0x04}, // preflop, seat 1 after dealer, 4 players, bet level 3
+    {0x50, 0x91, 0x00}, {0xb0, 0x30, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xa0, 0x32, 0x00}, {0x00, 0xc3, 0x00}, {0x00, 0xc3, 0x00}, // preflop, seat 2 after dealer, 2 players, bet level 0
+    {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xe0, 0x00, 0x01}, {0xe0, 0x01, 0x00}, {0x91, 0x40, 0x01}, {0x81, 0x24, 0x00}, // preflop, seat 2 after dealer, 2 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1b, 0x02, 0x01}, {0x80, 0x24, 0x00}, {0x82, 0x20, 0x03}, {0xb0, 0x13, 0x00}, // preflop, seat 2 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 2 after dealer, 2 players, bet level 3
+    {0xe0, 0x01, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x11, 0x00}, {0x10, 0x91, 0x04}, {0x00, 0xa2, 0x03}, // preflop, seat 2 after dealer, 3 players, bet level 0
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x95, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xb0, 0x04, 0x00}, {0x71, 0x00, 0x07}, // preflop, seat 2 after dealer, 3 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xa2, 0x00, 0x04}, // preflop, seat 2 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 2 after dealer, 3 players, bet level 3
+    {0x80, 0x07, 0x00}, {0xb0, 0x12, 0x01}, {0xd0, 0x01, 0x00}, {0xe0, 0x01, 0x00}, {0xe0, 0x01, 0x00}, {0x40, 0x0b, 0x00}, {0x10, 0x21, 0x0c}, {0x00, 0x21, 0x0c}, // preflop, seat 2 after dealer, 4 players, bet level 0
+    {0x0d, 0x02, 0x00}, {0x0e, 0x10, 0x00}, {0x0e, 0x10, 0x00}, {0x1d, 0x00, 0x00}, {0x47, 0x13, 0x00}, {0xb3, 0x10, 0x00}, {0xa0, 0x01, 0x03}, {0x11, 0x00, 0x0c}, // preflop, seat 2 after dealer, 4 players, bet level 1
+    {0x1e, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x3b, 0x01, 0x00}, {0x35, 0x12, 0x03}, {0x43, 0x40, 0x04}, // preflop, seat 2 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xb4, 0x00, 0x00}, {0xe1, 0x00, 0x00}, // preflop, seat 2 after dealer, 4 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 3 after dealer, 2 players, bet level 0
+    {0x87, 0x00, 0x00}, {0xb4, 0x00, 0x00}, {0x69, 0x00, 0x00}, {0x3b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xe0, 0x00, 0x00}, {0xa0, 0x50, 0x00}, {0x50, 0x80, 0x03}, // preflop, seat 3 after dealer, 2 players, bet level 1
+    {0x2d, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x74, 0x40, 0x00}, {0x80, 0x60, 0x00}, {0x60, 0x20, 0x07}, // preflop, seat 3 after dealer, 2 players, bet level 2
+    {0x1e, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xb4, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 3 after dealer, 2 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 3 after dealer, 3 players, bet level 0
+    {0x5a, 0x00, 0x00}, {0xc3, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xc0, 0x03, 0x00}, {0x40, 0x19, 0x00}, {0x50, 0x35, 0x02}, {0x10, 0x00, 0x0e}, // preflop, seat 3 after dealer, 3 players, bet level 1
+    {0x1e, 0x00, 0x00}, {0x87, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0e, 0x10, 0x00}, {0x24, 0x24, 0x02}, {0x22, 0x00, 0x0b}, // preflop, seat 3 after dealer, 3 players, bet level 2
+    {0x2d, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0xc3, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 3 after dealer, 3 players, bet level 3
+    {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, // preflop, seat 3 after dealer, 4 players, bet level 0
+    {0x2d, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0x2c, 0x00, 0x00}, {0x07, 0x34, 0x00}, {0x12, 0x2a, 0x00}, {0x21, 0xb1, 0x00}, {0x50, 0x00, 0x0a}, // preflop, seat 3 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x69, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0x5a, 0x00, 0x00}, {0x4a, 0x01, 0x00}, {0x1c, 0x11, 0x00}, {0xc2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // preflop, seat 3 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xd0, 0x01, 0x00}, {0xa0, 0x15, 0x00}, {0xd0, 0x11, 0x00}, // preflop, seat 3 after dealer, 4 players, bet level 3
+    {0xb0, 0x01, 0x03}, {0xb0, 0x04, 0x00}, {0x00, 0x02, 0x0c}, {0x00, 0x96, 0x00}, {0x40, 0x0b, 0x00}, {0x50, 0x0a, 0x00}, {0x00, 0x50, 0x09}, {0x10, 0xd1, 0x01}, // flop, seat 0 after dealer, 2 players, bet level 0
+    {0x90, 0x06, 0x00}, {0xc0, 0x03, 0x00}, {0x90, 0x50, 0x01}, {0xc0, 0x03, 0x00}, {0xb0, 0x03, 0x00}, {0x90, 0x06, 0x00}, {0x80, 0x00, 0x06}, {0x91, 0x31, 0x00}, // flop, seat 0 after dealer, 2 players, bet level 1
+    {0x0b, 0x20, 0x01}, {0x93, 0x03, 0x00}, {0x41, 0x0a, 0x00}, {0xa1, 0x03, 0x01}, {0xa1, 0x04, 0x00}, {0xb0, 0x04, 0x00}, {0x52, 0x12, 0x04}, {0x54, 0x11, 0x04}, // flop, seat 0 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 0 after dealer, 2 players, bet level 3
+    {0xe0, 0x10, 0x00}, {0x00, 0x0e, 0x00}, {0x10, 0x3a, 0x01}, {0x00, 0x96, 0x00}, {0x00, 0x0f, 0x00}, {0x00, 0x0f, 0x00}, {0x00, 0x80, 0x06}, {0x60, 0x71, 0x02}, // flop, seat 0 after dealer, 3 players, bet level 0
+    {0x38, 0x31, 0x00}, {0xd1, 0x01, 0x00}, {0x81, 0x23, 0x00}, {0xb0, 0x04, 0x00}, {0x91, 0x05, 0x00}, {0xa1, 0x04, 0x00}, {0xb1, 0x02, 0x01}, {0x71, 0x03, 0x04}, // flop, seat 0 after dealer, 3 players, bet level 1
+    {0x1c, 0x20, 0x00}, {0x3b, 0x01, 0x00}, {0xd2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x02, 0x00}, {0xf0, 0x00, 0x00}, {0xe0, 0x00, 0x00}, {0x83, 0x01, 0x03}, // flop, seat 0 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 0 after dealer, 3 players, bet level 3
+    {0xb0, 0x22, 0x00}, {0x20, 0x67, 0x00}, {0x40, 0x41, 0x06}, {0x10, 0x67, 0x00}, {0x20, 0x1c, 0x00}, {0x50, 0x37, 0x01}, {0x10, 0x11, 0x0b}, {0x30, 0x33, 0x06}, // flop, seat 0 after dealer, 4 players, bet level 0
+    {0x0d, 0x01, 0x00}, {0xd0, 0x01, 0x00}, {0x92, 0x31, 0x00}, {0xc1, 0x20, 0x01}, {0xc0, 0x12, 0x00}, {0xd0, 0x20, 0x00}, {0xd0, 0x10, 0x01}, {0xc1, 0x00, 0x02}, // flop, seat 0 after dealer, 4 players, bet level 1
+    {0x0e, 0x10, 0x00}, {0x0c, 0x03, 0x00}, {0x1d, 0x00, 0x00}, {0xe0, 0x00, 0x00}, {0x76, 0x11, 0x00}, {0xd2, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xd2, 0x00, 0x00}, // flop, seat 0 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xe1, 0x00, 0x00}, // flop, seat 0 after dealer, 4 players, bet level 3
+    {0xe0, 0x10, 0x00}, {0xd0, 0x02, 0x00}, {0xd0, 0x10, 0x00}, {0x00, 0xf0, 0x00}, {0xd0, 0x02, 0x00}, {0xe0, 0x01, 0x00}, {0x20, 0x90, 0x04}, {0x50, 0x11, 0x08}, // flop, seat 1 after dealer, 2 players, bet level 0
+    {0xd1, 0x02, 0x00}, {0xf0, 0x00, 0x00}, {0x90, 0x50, 0x00}, {0xe0, 0x10, 0x00}, {0xb0, 0x03, 0x00}, {0x90, 0x06, 0x00}, {0xf0, 0x00, 0x00}, {0x80, 0x07, 0x00}, // flop, seat 1 after dealer, 2 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0xe1, 0x01, 0x00}, {0x40, 0x29, 0x00}, {0xc1, 0x11, 0x00}, {0x90, 0x06, 0x00}, {0xa0, 0x05, 0x00}, {0xb1, 0x21, 0x01}, {0xb0, 0x00, 0x04}, // flop, seat 1 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x69, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 1 after dealer, 2 players, bet level 3
+    {0xc0, 0x03, 0x00}, {0x90, 0x16, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x11, 0x00}, {0x80, 0x07, 0x00}, {0xa0, 0x05, 0x00}, {0xe0, 0x00, 0x00}, {0x60, 0x11, 0x07}, // flop, seat 1 after dealer, 3 players, bet level 0
+    {0x78, 0x00, 0x00}, {0x91, 0x05, 0x00}, {0x71, 0x25, 0x00}, {0xc0, 0x10, 0x02}, {0xa0, 0x05, 0x00}, {0xa0, 0x04, 0x00}, {0xb0, 0x12, 0x00}, {0x90, 0x10, 0x05}, // flop, seat 1 after dealer, 3 players, bet level 1
+    {0x0d, 0x20, 0x00}, {0x1c, 0x02, 0x00}, {0xd0, 0x02, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xc0, 0x00, 0x03}, {0xc0, 0x00, 0x03}, // flop, seat 1 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 1 after dealer, 3 players, bet level 3
+    {0xc0, 0x02, 0x00}, {0x70, 0x63, 0x00}, {0xa0, 0x40, 0x01}, {0xe0, 0x01, 0x00}, {0xd0, 0x02, 0x00}, {0x90, 0x15, 0x00}, {0x50, 0x37, 0x00}, {0x20, 0x24, 0x07}, // flop, seat 1 after dealer, 4 players, bet level 0
+    {0xd1, 0x02, 0x00}, {0xd0, 0x02, 0x00}, {0xd0, 0x00, 0x01}, {0xe0, 0x00, 0x00}, {0xc0, 0x21, 0x01}, {0xd0, 0x01, 0x01}, {0xe0, 0x01, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 1 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x1b, 0x03, 0x00}, {0x74, 0x12, 0x00}, {0xe0, 0x01, 0x00}, {0xd0, 0x01, 0x00}, {0x58, 0x01, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 1 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 1 after dealer, 4 players, bet level 3
+    {0xb0, 0x40, 0x00}, {0xa0, 0x22, 0x00}, {0x30, 0x64, 0x02}, {0x00, 0xf0, 0x00}, {0x00, 0x0f, 0x00}, {0x00, 0x0f, 0x00}, {0x00, 0xb0, 0x04}, {0x00, 0x11, 0x0d}, // flop, seat 2 after dealer, 2 players, bet level 0
+    {0x65, 0x13, 0x00}, {0xe0, 0x00, 0x00}, {0xc0, 0x30, 0x00}, {0xd1, 0x10, 0x00}, {0xc0, 0x03, 0x00}, {0xb1, 0x04, 0x00}, {0xd0, 0x10, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 2 after dealer, 2 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0xc3, 0x00, 0x00}, {0xb1, 0x21, 0x00}, {0xd0, 0x11, 0x00}, {0xb1, 0x03, 0x00}, {0xc1, 0x03, 0x00}, {0xa2, 0x00, 0x03}, {0x71, 0x00, 0x06}, // flop, seat 2 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 2 after dealer, 2 players, bet level 3
+    {0xb0, 0x12, 0x00}, {0x70, 0x16, 0x00}, {0xa0, 0x15, 0x00}, {0x10, 0xc0, 0x01}, {0x50, 0x0a, 0x00}, {0xa0, 0x05, 0x00}, {0x20, 0x58, 0x01}, {0x10, 0x21, 0x0b}, // flop, seat 2 after dealer, 3 players, bet level 0
+    {0x49, 0x11, 0x00}, {0x53, 0x07, 0x00}, {0x81, 0x24, 0x01}, {0xb0, 0x22, 0x00}, {0x91, 0x14, 0x00}, {0x71, 0x07, 0x00}, {0xc0, 0x02, 0x01}, {0x80, 0x11, 0x05}, // flop, seat 2 after dealer, 3 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0e, 0x01, 0x00}, {0x71, 0x60, 0x01}, {0xd0, 0x10, 0x00}, {0x90, 0x32, 0x01}, {0xa0, 0x33, 0x00}, {0xb0, 0x30, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 2 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0xb4, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xe1, 0x00, 0x00}, // flop, seat 2 after dealer, 3 players, bet level 3
+    {0x70, 0x08, 0x00}, {0x20, 0x2b, 0x00}, {0xb0, 0x04, 0x00}, {0x30, 0x65, 0x01}, {0x10, 0x0c, 0x02}, {0xb0, 0x40, 0x01}, {0x20, 0x28, 0x03}, {0x40, 0x44, 0x03}, // flop, seat 2 after dealer, 4 players, bet level 0
+    {0x33, 0x09, 0x00}, {0x62, 0x07, 0x00}, {0x81, 0x40, 0x02}, {0xd0, 0x02, 0x00}, {0xa0, 0x31, 0x01}, {0x90, 0x60, 0x00}, {0x90, 0x21, 0x02}, {0x66, 0x11, 0x01}, // flop, seat 2 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xa2, 0x02, 0x00}, {0xe0, 0x00, 0x00}, {0xa0, 0x21, 0x01}, {0xc1, 0x03, 0x00}, {0xb0, 0x10, 0x02}, {0xc2, 0x01, 0x00}, // flop, seat 2 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x88, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0x88, 0x00, 0x00}, // flop, seat 2 after dealer, 4 players, bet level 3
+    {0xb0, 0x02, 0x01}, {0xa0, 0x05, 0x00}, {0x10, 0x18, 0x04}, {0x00, 0xf0, 0x00}, {0x70, 0x08, 0x00}, {0x80, 0x07, 0x00}, {0x00, 0xd0, 0x02}, {0x00, 0x00, 0x0f}, // flop, seat 3 after dealer, 2 players, bet level 0
+    {0xe0, 0x01, 0x00}, {0xc0, 0x12, 0x00}, {0xa1, 0x30, 0x01}, {0xc0, 0x00, 0x02}, {0x90, 0x40, 0x01}, {0x80, 0x40, 0x02}, {0xc0, 0x10, 0x02}, {0x70, 0x12, 0x05}, // flop, seat 3 after dealer, 2 players, bet level 1
+    {0x1c, 0x20, 0x00}, {0xa3, 0x01, 0x00}, {0x72, 0x06, 0x00}, {0xb1, 0x12, 0x01}, {0x92, 0x04, 0x00}, {0xb1, 0x03, 0x00}, {0x82, 0x01, 0x04}, {0x51, 0x01, 0x08}, // flop, seat 3 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 3 after dealer, 2 players, bet level 3
+    {0x70, 0x35, 0x00}, {0x70, 0x07, 0x00}, {0x00, 0x09, 0x05}, {0x00, 0xb3, 0x01}, {0x10, 0x0e, 0x00}, {0x40, 0x0b, 0x00}, {0x00, 0xa0, 0x05}, {0x60, 0x44, 0x01}, // flop, seat 3 after dealer, 3 players, bet level 0
+    {0x85, 0x02, 0x00}, {0x84, 0x03, 0x00}, {0xa1, 0x21, 0x01}, {0xb0, 0x22, 0x00}, {0xc0, 0x02, 0x00}, {0xd0, 0x01, 0x01}, {0xa0, 0x14, 0x00}, {0x90, 0x03, 0x03}, // flop, seat 3 after dealer, 3 players, bet level 1
+    {0x0d, 0x00, 0x01}, {0x1e, 0x00, 0x00}, {0xd1, 0x00, 0x00}, {0xe0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xc0, 0x02, 0x00}, {0x91, 0x02, 0x03}, {0x72, 0x01, 0x05}, // flop, seat 3 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // flop, seat 3 after dealer, 3 players, bet level 3
+    {0x90, 0x15, 0x00}, {0xa0, 0x05, 0x00}, {0x20, 0x0d, 0x00}, {0x40, 0xb0, 0x00}, {0x30, 0x0c, 0x00}, {0x60, 0x32, 0x04}, {0x10, 0x76, 0x00}, {0x50, 0x43, 0x02}, // flop, seat 3 after dealer, 4 players, bet level 0
+    {0x83, 0x04, 0x00}, {0x65, 0x04, 0x00}, {0xa1, 0x23, 0x00}, {0xa1, 0x30, 0x02}, {0xb0, 0x22, 0x00}, {0xa0, 0x41, 0x00}, {0x53, 0x20, 0x05}, {0xb0, 0x31, 0x01}, // flop, seat 3 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0d, 0x10, 0x00}, {0xf0, 0x00, 0x00}, {0xb0, 0x23, 0x00}, {0xc1, 0x02, 0x00}, {0xe0, 0x01, 0x00}, {0xa1, 0x03, 0x00}, // flop, seat 3 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x88, 0x00, 0x00}, // flop, seat 3 after dealer, 4 players, bet level 3
+    {0x40, 0x80, 0x04}, {0x80, 0x60, 0x00}, {0x10, 0x82, 0x04}, {0x00, 0xb4, 0x00}, {0x00, 0x0f, 0x00}, {0x00, 0x0f, 0x00}, {0x20, 0x52, 0x07}, {0x20, 0x25, 0x06}, // turn, seat 0 after dealer, 2 players, bet level 0
+    {0x81, 0x33, 0x00}, {0xa1, 0x31, 0x00}, {0xb0, 0x21, 0x00}, {0xd0, 0x00, 0x00}, {0xd0, 0x01, 0x00}, {0xc0, 0x02, 0x00}, {0xe0, 0x00, 0x01}, {0xd0, 0x00, 0x01}, // turn, seat 0 after dealer, 2 players, bet level 1
+    {0x1a, 0x30, 0x01}, {0xa4, 0x10, 0x00}, {0xb1, 0x12, 0x00}, {0x82, 0x32, 0x00}, {0xa1, 0x05, 0x00}, {0xa1, 0x05, 0x00}, {0x82, 0x21, 0x02}, {0x92, 0x01, 0x02}, // turn, seat 0 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0x87, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 0 after dealer, 2 players, bet level 3
+    {0xc0, 0x30, 0x00}, {0x60, 0x54, 0x00}, {0x10, 0x29, 0x03}, {0x00, 0xa4, 0x00}, {0x00, 0x0f, 0x00}, {0x00, 0x0f, 0x00}, {0x10, 0x41, 0x09}, {0x20, 0x22, 0x0a}, // turn, seat 0 after dealer, 3 players, bet level 0
+    {0x33, 0x63, 0x00}, {0x83, 0x04, 0x00}, {0x82, 0x05, 0x00}, {0x91, 0x12, 0x02}, {0xe0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xc1, 0x10, 0x02}, {0xb0, 0x00, 0x03}, // turn, seat 0 after dealer, 3 players, bet level 1
+    {0x1c, 0x20, 0x00}, {0x0e, 0x01, 0x00}, {0xc3, 0x00, 0x00}, {0x55, 0x32, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xc1, 0x10, 0x02}, {0xc1, 0x00, 0x02}, // turn, seat 0 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 0 after dealer, 3 players, bet level 3
+    {0x70, 0x80, 0x00}, {0x80, 0x42, 0x00}, {0x00, 0x91, 0x05}, {0x10, 0x81, 0x04}, {0x10, 0x82, 0x04}, {0x00, 0xc2, 0x02}, {0x10, 0x1b, 0x02}, {0x10, 0x46, 0x04}, // turn, seat 0 after dealer, 4 players, bet level 0
+    {0x65, 0x40, 0x00}, {0x93, 0x12, 0x00}, {0xc1, 0x10, 0x00}, {0xc0, 0x01, 0x01}, {0xd0, 0x11, 0x00}, {0xd0, 0x20, 0x00}, {0xd0, 0x10, 0x01}, {0xd0, 0x20, 0x00}, // turn, seat 0 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1d, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x11, 0x00}, {0xd1, 0x00, 0x00}, // turn, seat 0 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0xb4, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x87, 0x00, 0x00}, // turn, seat 0 after dealer, 4 players, bet level 3
+    {0xf0, 0x00, 0x00}, {0xb0, 0x04, 0x00}, {0x90, 0x32, 0x01}, {0x10, 0xe0, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xe0, 0x00, 0x01}, {0x20, 0x22, 0x0a}, // turn, seat 1 after dealer, 2 players, bet level 0
+    {0x31, 0x0c, 0x00}, {0xc0, 0x03, 0x00}, {0xb0, 0x13, 0x00}, {0xd1, 0x10, 0x00}, {0x90, 0x50, 0x01}, {0x90, 0x60, 0x00}, {0xc0, 0x00, 0x02}, {0xe0, 0x00, 0x01}, // turn, seat 1 after dealer, 2 players, bet level 1
+    {0x0b, 0x00, 0x03}, {0x1c, 0x11, 0x00}, {0x81, 0x24, 0x00}, {0xc1, 0x02, 0x00}, {0x30, 0x0c, 0x00}, {0x40, 0x0b, 0x00}, {0x80, 0x14, 0x02}, {0xd0, 0x00, 0x02}, // turn, seat 1 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x5a, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 1 after dealer, 2 players, bet level 3
+    {0xd0, 0x11, 0x00}, {0xd0, 0x02, 0x00}, {0x50, 0x27, 0x01}, {0x80, 0x60, 0x01}, {0xf0, 0x00, 0x00}, {0xe0, 0x01, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x20, 0x00}, // turn, seat 1 after dealer, 3 players, bet level 0
+    {0x24, 0x18, 0x00}, {0x5a, 0x01, 0x00}, {0xc1, 0x11, 0x00}, {0x81, 0x50, 0x01}, {0xc0, 0x20, 0x00}, {0xe0, 0x01, 0x00}, {0xd0, 0x10, 0x00}, {0xd0, 0x00, 0x02}, // turn, seat 1 after dealer, 3 players, bet level 1
+    {0x0e, 0x10, 0x00}, {0x0f, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0x92, 0x13, 0x00}, {0xe0, 0x00, 0x01}, {0xf0, 0x00, 0x00}, {0xd0, 0x00, 0x02}, {0xd0, 0x20, 0x00}, // turn, seat 1 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 1 after dealer, 3 players, bet level 3
+    {0x90, 0x06, 0x01}, {0x50, 0x0a, 0x00}, {0x30, 0x18, 0x03}, {0x60, 0x80, 0x01}, {0xe0, 0x10, 0x00}, {0xd0, 0x20, 0x00}, {0xe0, 0x00, 0x01}, {0x50, 0xa0, 0x00}, // turn, seat 1 after dealer, 4 players, bet level 0
+    {0xa3, 0x02, 0x00}, {0xa3, 0x02, 0x00}, {0xe0, 0x00, 0x00}, {0xe0, 0x00, 0x01}, {0xd0, 0x10, 0x01}, {0xf0, 0x00, 0x00}, {0xd0, 0x21, 0x00}, {0xc0, 0x20, 0x01}, // turn, seat 1 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xe0, 0x10, 0x00}, {0xe0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 1 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x87, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xa5, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 1 after dealer, 4 players, bet level 3
+    {0x90, 0x41, 0x00}, {0xb0, 0x13, 0x00}, {0x80, 0x42, 0x00}, {0x10, 0xe0, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x40, 0xa0, 0x01}, {0x90, 0x11, 0x04}, // turn, seat 2 after dealer, 2 players, bet level 0
+    {0x91, 0x23, 0x00}, {0xd0, 0x01, 0x00}, {0x90, 0x06, 0x00}, {0xc0, 0x30, 0x00}, {0x60, 0x80, 0x00}, {0xa0, 0x51, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 2 after dealer, 2 players, bet level 1
+    {0x0e, 0x10, 0x00}, {0x49, 0x11, 0x00}, {0x91, 0x32, 0x00}, {0x92, 0x32, 0x00}, {0x40, 0x0b, 0x00}, {0x30, 0x0c, 0x00}, {0x91, 0x22, 0x01}, {0x91, 0x02, 0x03}, // turn, seat 2 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 2 after dealer, 2 players, bet level 3
+    {0xa0, 0x14, 0x01}, {0xb0, 0x13, 0x00}, {0x50, 0x19, 0x00}, {0x50, 0xa0, 0x00}, {0xe0, 0x10, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x10, 0x00}, {0xc0, 0x02, 0x01}, // turn, seat 2 after dealer, 3 players, bet level 0
+    {0x83, 0x13, 0x00}, {0x77, 0x00, 0x00}, {0xc1, 0x03, 0x00}, {0x81, 0x50, 0x01}, {0xe0, 0x10, 0x00}, {0xd0, 0x20, 0x00}, {0xd0, 0x20, 0x00}, {0xd0, 0x00, 0x02}, // turn, seat 2 after dealer, 3 players, bet level 1
+    {0x0e, 0x00, 0x01}, {0x0f, 0x00, 0x00}, {0x1d, 0x00, 0x01}, {0x64, 0x22, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xe0, 0x00, 0x01}, // turn, seat 2 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 2 after dealer, 3 players, bet level 3
+    {0x50, 0x18, 0x01}, {0x60, 0x18, 0x00}, {0x60, 0x19, 0x00}, {0x90, 0x42, 0x00}, {0xf0, 0x00, 0x00}, {0x70, 0x62, 0x00}, {0x10, 0x92, 0x02}, {0x20, 0x92, 0x02}, // turn, seat 2 after dealer, 4 players, bet level 0
+    {0x33, 0x45, 0x00}, {0x33, 0x09, 0x00}, {0x61, 0x17, 0x00}, {0x71, 0x40, 0x03}, {0xb0, 0x30, 0x00}, {0xa0, 0x40, 0x01}, {0x81, 0x40, 0x02}, {0x81, 0x30, 0x03}, // turn, seat 2 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x77, 0x01, 0x00}, {0xc0, 0x12, 0x00}, {0x3c, 0x00, 0x00}, {0xa0, 0x14, 0x00}, {0x73, 0x41, 0x00}, // turn, seat 2 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0xc3, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0x88, 0x00, 0x00}, // turn, seat 2 after dealer, 4 players, bet level 3
+    {0x80, 0x60, 0x02}, {0x80, 0x43, 0x00}, {0x10, 0x45, 0x05}, {0x00, 0xe0, 0x00}, {0x00, 0x0e, 0x00}, {0x10, 0x0e, 0x00}, {0x10, 0xa1, 0x04}, {0x20, 0x22, 0x09}, // turn, seat 3 after dealer, 2 players, bet level 0
+    {0x62, 0x52, 0x00}, {0xc1, 0x20, 0x00}, {0xd0, 0x00, 0x01}, {0xc0, 0x20, 0x00}, {0xb0, 0x03, 0x00}, {0xb0, 0x03, 0x00}, {0xd0, 0x00, 0x02}, {0xb0, 0x10, 0x03}, // turn, seat 3 after dealer, 2 players, bet level 1
+    {0x0d, 0x10, 0x01}, {0x68, 0x01, 0x00}, {0xb1, 0x03, 0x00}, {0x81, 0x32, 0x00}, {0x91, 0x05, 0x00}, {0x91, 0x05, 0x00}, {0x92, 0x11, 0x03}, {0x92, 0x01, 0x04}, // turn, seat 3 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x5a, 0x00, 0x00}, {0xa5, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 3 after dealer, 2 players, bet level 3
+    {0x30, 0x74, 0x01}, {0x90, 0x15, 0x00}, {0x40, 0x46, 0x02}, {0x00, 0xf0, 0x00}, {0x00, 0x2c, 0x00}, {0x30, 0x1b, 0x00}, {0x00, 0xe0, 0x01}, {0x10, 0x63, 0x05}, // turn, seat 3 after dealer, 3 players, bet level 0
+    {0x62, 0x34, 0x00}, {0x34, 0x17, 0x00}, {0x81, 0x14, 0x01}, {0x62, 0x50, 0x02}, {0xc0, 0x12, 0x00}, {0xa0, 0x04, 0x00}, {0x91, 0x20, 0x03}, {0xb0, 0x10, 0x03}, // turn, seat 3 after dealer, 3 players, bet level 1
+    {0x0e, 0x10, 0x00}, {0x0f, 0x00, 0x00}, {0x37, 0x41, 0x01}, {0x44, 0x42, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xa2, 0x20, 0x02}, {0xc0, 0x10, 0x02}, // turn, seat 3 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // turn, seat 3 after dealer, 3 players, bet level 3
+    {0x60, 0x16, 0x01}, {0x70, 0x07, 0x01}, {0x20, 0x18, 0x04}, {0x00, 0x1e, 0x00}, {0x10, 0x36, 0x04}, {0xd0, 0x11, 0x00}, {0x00, 0xb0, 0x04}, {0x10, 0x51, 0x08}, // turn, seat 3 after dealer, 4 players, bet level 0
+    {0xb1, 0x21, 0x00}, {0x64, 0x05, 0x00}, {0x92, 0x13, 0x00}, {0xb0, 0x30, 0x00}, {0xd0, 0x01, 0x00}, {0xb0, 0x21, 0x00}, {0xf0, 0x00, 0x00}, {0xb0, 0x40, 0x00}, // turn, seat 3 after dealer, 4 players, bet level 1
+    {0x1d, 0x10, 0x00}, {0x0f, 0x00, 0x00}, {0x2c, 0x00, 0x00}, {0xa4, 0x10, 0x00}, {0xe0, 0x01, 0x00}, {0xd0, 0x02, 0x00}, {0xc1, 0x11, 0x00}, {0xb2, 0x02, 0x00}, // turn, seat 3 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x78, 0x00, 0x00}, {0x78, 0x00, 0x00}, // turn, seat 3 after dealer, 4 players, bet level 3
+    {0x20, 0x42, 0x07}, {0x90, 0x31, 0x02}, {0xa0, 0x24, 0x00}, {0x10, 0xb1, 0x02}, {0x00, 0xe0, 0x01}, {0x10, 0xc1, 0x02}, {0x30, 0x63, 0x04}, {0x10, 0xa1, 0x02}, // river, seat 0 after dealer, 2 players, bet level 0
+    {0x33, 0x61, 0x02}, {0xb1, 0x11, 0x00}, {0xa1, 0x03, 0x02}, {0xa1, 0x20, 0x02}, {0x71, 0x60, 0x01}, {0x81, 0x50, 0x01}, {0x81, 0x50, 0x01}, {0x71, 0x60, 0x01}, // river, seat 0 after dealer, 2 players, bet level 1
+    {0x36, 0x51, 0x00}, {0x4b, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0x83, 0x31, 0x00}, {0x51, 0x08, 0x00}, {0x52, 0x34, 0x00}, {0x55, 0x13, 0x01}, {0x74, 0x12, 0x01}, // river, seat 0 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x5a, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 0 after dealer, 2 players, bet level 3
+    {0x60, 0x90, 0x00}, {0xe0, 0x01, 0x00}, {0xd0, 0x00, 0x01}, {0x20, 0xb1, 0x02}, {0x00, 0xc2, 0x00}, {0x10, 0x71, 0x07}, {0x20, 0x72, 0x04}, {0x20, 0x82, 0x03}, // river, seat 0 after dealer, 3 players, bet level 0
+    {0x1c, 0x20, 0x00}, {0x29, 0x13, 0x00}, {0x82, 0x14, 0x00}, {0xc1, 0x20, 0x00}, {0xb1, 0x30, 0x00}, {0xb1, 0x00, 0x02}, {0xb2, 0x10, 0x01}, {0xb1, 0x20, 0x01}, // river, seat 0 after dealer, 3 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1c, 0x02, 0x00}, {0x57, 0x22, 0x00}, {0x92, 0x12, 0x00}, {0xa2, 0x10, 0x00}, {0xc2, 0x01, 0x00}, {0xd1, 0x00, 0x00}, // river, seat 0 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0x87, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 0 after dealer, 3 players, bet level 3
+    {0x40, 0x61, 0x04}, {0xd0, 0x20, 0x00}, {0x40, 0x47, 0x00}, {0x50, 0xa0, 0x00}, {0x00, 0xf0, 0x00}, {0xb0, 0x32, 0x00}, {0x00, 0xf0, 0x00}, {0x50, 0x55, 0x01}, // river, seat 0 after dealer, 4 players, bet level 0
+    {0x0e, 0x00, 0x00}, {0x69, 0x01, 0x00}, {0xa3, 0x01, 0x00}, {0xa4, 0x01, 0x00}, {0xe0, 0x10, 0x00}, {0xe0, 0x01, 0x00}, {0xd0, 0x10, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 0 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xa5, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xd1, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 0 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x88, 0x00, 0x00}, // river, seat 0 after dealer, 4 players, bet level 3
+    {0x00, 0xd0, 0x01}, {0xc0, 0x03, 0x00}, {0x80, 0x25, 0x00}, {0x00, 0xe0, 0x00}, {0x40, 0xb0, 0x00}, {0x00, 0x90, 0x05}, {0x20, 0x22, 0x08}, {0x30, 0x33, 0x06}, // river, seat 1 after dealer, 2 players, bet level 0
+    {0x4a, 0x00, 0x00}, {0x61, 0x08, 0x00}, {0x80, 0x06, 0x00}, {0xe1, 0x00, 0x00}, {0xa0, 0x30, 0x01}, {0xe0, 0x10, 0x00}, {0xb1, 0x30, 0x00}, {0xb0, 0x40, 0x00}, // river, seat 1 after dealer, 2 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0x85, 0x02, 0x00}, {0x77, 0x00, 0x00}, {0x91, 0x13, 0x00}, {0xd2, 0x00, 0x00}, {0xc3, 0x00, 0x00}, {0xc1, 0x00, 0x01}, // river, seat 1 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x2d, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 1 after dealer, 2 players, bet level 3
+    {0x20, 0xb0, 0x02}, {0x60, 0x18, 0x00}, {0x80, 0x25, 0x00}, {0x40, 0xb0, 0x00}, {0xa0, 0x23, 0x00}, {0x30, 0xc0, 0x00}, {0x20, 0x42, 0x07}, {0xc0, 0x00, 0x02}, // river, seat 1 after dealer, 3 players, bet level 0
+    {0x0e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x82, 0x06, 0x00}, {0xd1, 0x00, 0x01}, {0xa0, 0x40, 0x01}, {0xc0, 0x10, 0x01}, {0xe0, 0x10, 0x00}, {0xb0, 0x30, 0x02}, // river, seat 1 after dealer, 3 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x1d, 0x00, 0x00}, {0x1e, 0x01, 0x00}, {0x1e, 0x00, 0x00}, {0xb1, 0x13, 0x00}, {0xe0, 0x10, 0x00}, {0xf0, 0x00, 0x00}, {0xe0, 0x00, 0x00}, // river, seat 1 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 1 after dealer, 3 players, bet level 3
+    {0xf0, 0x00, 0x00}, {0x20, 0x0d, 0x00}, {0x30, 0x1b, 0x00}, {0x20, 0x62, 0x06}, {0x40, 0x91, 0x01}, {0x10, 0xa0, 0x04}, {0x40, 0x42, 0x05}, {0xe0, 0x10, 0x00}, // river, seat 1 after dealer, 4 players, bet level 0
+    {0x1e, 0x10, 0x00}, {0x0f, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0x3b, 0x01, 0x00}, {0xe0, 0x10, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x20, 0x00}, {0xe0, 0x10, 0x00}, // river, seat 1 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0xe0, 0x10, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 1 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 1 after dealer, 4 players, bet level 3
+    {0x00, 0x90, 0x05}, {0xc0, 0x12, 0x00}, {0xa0, 0x14, 0x00}, {0x00, 0xf0, 0x00}, {0x50, 0xa0, 0x00}, {0x00, 0xc0, 0x02}, {0x20, 0x52, 0x06}, {0x30, 0x33, 0x06}, // river, seat 2 after dealer, 2 players, bet level 0
+    {0x37, 0x30, 0x02}, {0x81, 0x06, 0x01}, {0x90, 0x04, 0x02}, {0xa1, 0x10, 0x02}, {0x80, 0x50, 0x02}, {0xa1, 0x30, 0x01}, {0x81, 0x50, 0x02}, {0x71, 0x60, 0x01}, // river, seat 2 after dealer, 2 players, bet level 1
+    {0x1c, 0x20, 0x00}, {0x2d, 0x00, 0x00}, {0x91, 0x05, 0x00}, {0x55, 0x32, 0x00}, {0x71, 0x16, 0x00}, {0x92, 0x22, 0x00}, {0x82, 0x11, 0x02}, {0xa2, 0x01, 0x02}, // river, seat 2 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x96, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 2 after dealer, 2 players, bet level 3
+    {0x80, 0x60, 0x00}, {0x40, 0x0a, 0x00}, {0x20, 0x67, 0x00}, {0x00, 0xf0, 0x00}, {0x80, 0x70, 0x00}, {0x20, 0xd0, 0x00}, {0x10, 0x71, 0x06}, {0x30, 0x53, 0x04}, // river, seat 2 after dealer, 3 players, bet level 0
+    {0x0e, 0x10, 0x00}, {0x0d, 0x10, 0x00}, {0x44, 0x07, 0x00}, {0x72, 0x50, 0x00}, {0x91, 0x50, 0x00}, {0x91, 0x50, 0x00}, {0x81, 0x60, 0x00}, {0xa0, 0x40, 0x01}, // river, seat 2 after dealer, 3 players, bet level 1
+    {0x1b, 0x30, 0x00}, {0x0d, 0x01, 0x00}, {0x0f, 0x00, 0x00}, {0x1b, 0x03, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x10, 0x01}, {0xc0, 0x10, 0x01}, // river, seat 2 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xd2, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 2 after dealer, 3 players, bet level 3
+    {0x40, 0x52, 0x03}, {0x00, 0x2c, 0x00}, {0x00, 0x1d, 0x01}, {0x40, 0x51, 0x05}, {0x40, 0xa0, 0x01}, {0x70, 0x70, 0x01}, {0x10, 0x81, 0x06}, {0x00, 0xf0, 0x00}, // river, seat 2 after dealer, 4 players, bet level 0
+    {0x06, 0x41, 0x03}, {0x17, 0x15, 0x00}, {0x42, 0x08, 0x00}, {0x23, 0x81, 0x01}, {0x52, 0x61, 0x01}, {0x42, 0x60, 0x03}, {0x52, 0x60, 0x02}, {0x53, 0x61, 0x00}, // river, seat 2 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x0e, 0x00, 0x00}, {0x09, 0x33, 0x00}, {0xe0, 0x01, 0x00}, {0xc1, 0x20, 0x00}, {0xd0, 0x20, 0x00}, {0x66, 0x12, 0x00}, // river, seat 2 after dealer, 4 players, bet level 2
+    {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x87, 0x00, 0x00}, // river, seat 2 after dealer, 4 players, bet level 3
+    {0x10, 0x61, 0x06}, {0xc0, 0x30, 0x00}, {0xa0, 0x40, 0x01}, {0x10, 0xc1, 0x02}, {0x00, 0xd0, 0x01}, {0x10, 0xb1, 0x03}, {0x20, 0x62, 0x04}, {0x30, 0x63, 0x04}, // river, seat 3 after dealer, 2 players, bet level 0
+    {0x26, 0x40, 0x02}, {0xa1, 0x03, 0x01}, {0x90, 0x04, 0x02}, {0xa1, 0x30, 0x01}, {0x71, 0x60, 0x01}, {0x71, 0x70, 0x01}, {0x71, 0x60, 0x01}, {0x71, 0x70, 0x01}, // river, seat 3 after dealer, 2 players, bet level 1
+    {0x2a, 0x30, 0x00}, {0x0d, 0x11, 0x00}, {0xd0, 0x02, 0x00}, {0x64, 0x41, 0x00}, {0x61, 0x17, 0x00}, {0x62, 0x34, 0x00}, {0x64, 0x12, 0x02}, {0x84, 0x11, 0x02}, // river, seat 3 after dealer, 2 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x0f, 0x00, 0x00}, {0xa5, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 3 after dealer, 2 players, bet level 3
+    {0x20, 0xb0, 0x02}, {0x30, 0x18, 0x02}, {0x70, 0x24, 0x02}, {0x30, 0xa1, 0x01}, {0x50, 0xa0, 0x00}, {0x00, 0xc0, 0x03}, {0x20, 0x82, 0x04}, {0x20, 0x72, 0x04}, // river, seat 3 after dealer, 3 players, bet level 0
+    {0x27, 0x70, 0x00}, {0x34, 0x09, 0x00}, {0x33, 0x35, 0x00}, {0x54, 0x60, 0x00}, {0x71, 0x60, 0x00}, {0x72, 0x50, 0x01}, {0x82, 0x20, 0x01}, {0xb1, 0x10, 0x01}, // river, seat 3 after dealer, 3 players, bet level 1
+    {0x1b, 0x03, 0x00}, {0x0e, 0x01, 0x00}, {0x0f, 0x00, 0x00}, {0x54, 0x33, 0x00}, {0xb1, 0x21, 0x00}, {0x92, 0x11, 0x01}, {0xb2, 0x11, 0x01}, {0xc2, 0x00, 0x00}, // river, seat 3 after dealer, 3 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x1e, 0x00, 0x00}, {0x3c, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, // river, seat 3 after dealer, 3 players, bet level 3
+    {0x30, 0x48, 0x00}, {0x80, 0x06, 0x00}, {0xf0, 0x00, 0x00}, {0x10, 0x47, 0x03}, {0x30, 0x72, 0x04}, {0x90, 0x60, 0x00}, {0x30, 0x2a, 0x00}, {0x50, 0x55, 0x00}, // river, seat 3 after dealer, 4 players, bet level 0
+    {0x09, 0x14, 0x00}, {0x35, 0x07, 0x00}, {0x91, 0x04, 0x00}, {0x92, 0x10, 0x02}, {0x82, 0x20, 0x03}, {0xa1, 0x21, 0x01}, {0xa2, 0x20, 0x01}, {0xc0, 0x30, 0x00}, // river, seat 3 after dealer, 4 players, bet level 1
+    {0x0f, 0x00, 0x00}, {0x0c, 0x20, 0x00}, {0x0d, 0x10, 0x00}, {0x95, 0x01, 0x00}, {0xa1, 0x04, 0x00}, {0xf0, 0x00, 0x00}, {0xd0, 0x11, 0x00}, {0x86, 0x00, 0x00}, // river, seat 3 after dealer, 4 players, bet level 2
+    {0x0f, 0x00, 0x00}, {0x4b, 0x00, 0x00}, {0x69, 0x00, 0x00}, {0xe1, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0xf0, 0x00, 0x00}, {0x88, 0x00, 0x00}, // river, seat 3 after dealer, 4 players, bet level 3
+};
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "trace.h"
+
+#ifdef HOLDEM_TRACE
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spsc_ring.h"
+
+// Per thread: 64K events (1 MB), several milliseconds of the busiest
+// driver loop, against a writer that drains every TRACE_FLUSH_US
+#define TRACE_RING_CAPACITY (1u << 16)
+#define TRACE_FLUSH_US 2000
+#define TRACE_SPOOL_BATCH 4096
+#define TRACE_THREAD_NAME_SIZE 32
+
+typedef struct {
+    uint64_t time;
+    uint32_t duration; // Ticks, complete events only (saturates)
+    uint8_t name;
+    char phase; // Chrome event type: 'X' complete, 'B' begin, 'E' end
+    uint16_t tid;
+} TraceEvent;
+
+_Static_assert(sizeof(TraceEvent) == 16, "TraceEvent must stay 16 bytes");
+
+typedef struct TraceBuffer {
+    SpscRing ring; // Produced by the owning thread, consumed by the writer
+    struct TraceBuffer* next;
+    _Atomic uint64_t dropped;
+    uint16_t tid;
+    char thread_name[TRACE_THREAD_NAME_SIZE]; // Read once the owner is done
+    TraceEvent events[TRACE_RING_CAPACITY];
+} TraceBuffer;
+
+_Atomic bool trace_enabled;
+_Thread_local bool trace_paused;
+static _Atomic uint32_t trace_generation;
+static _Atomic(TraceBuffer*) trace_buffers;
+static _Atomic uint16_t trace_thread_count;
+
+// Writer state, only touched by trace_open, the writer thread and trace_close.
+// Formatting JSON is far slower than the game loops produce events, so the
+// writer only copies raw events into an unlinked spool file; trace_close
+// turns the spool into JSON once recording has stopped.
+static FILE* trace_file;
+static FILE* trace_spool;
+static bool trace_spool_failed;
+static pthread_t trace_writer;
+static _Atomic bool trace_stop;
+static uint64_t trace_origin;
+static double trace_ticks_per_us;
+static uint64_t trace_written;
+
+// A buffer belongs to one trace_open; a thread that outlives a trace_close
+// gets a fresh one from the next generation
+static _Thread_local TraceBuffer* trace_local;
+static _Thread_local uint32_t trace_local_generation;
+
+static const char* trace_names[TRACE_NAME_COUNT] = {
+    "preflop", "flop", "turn", "river", "deal", "ai_decide", "showdown", "ai_worker_wait"};
+
+static TraceBuffer* trace_buffer(void) {
+    uint32_t generation = atomic_load_explicit(&trace_generation, memory_order_relaxed);
+    if(trace_local && trace_local_generation == generation) return trace_local;
+
+    TraceBuffer* buffer = calloc(1, sizeof(TraceBuffer));
+    if(!buffer) return NULL;
+    spsc_ring_init(&buffer->ring, buffer->events, sizeof(TraceEvent), TRACE_RING_CAPACITY);
+    buffer->tid = atomic_fetch_add_explicit(&trace_thread_count, 1, memory_order_relaxed) + 1;
+    snprintf(buffer->thread_name, sizeof(buffer->thread_name), "thread %u", buffer->tid);
+
+    // Release: the writer walks the list and must see the initialized ring
+    buffer->next = atomic_load_explicit(&trace_buffers, memory_order_relaxed);
+    while(!atomic_compare_exchange_weak_explicit(
+        &trace_buffers, &buffer->next, buffer, memory_order_release, memory_order_relaxed)) {
+    }
+
+    trace_local = buffer;
+    trace_local_generation = generation;
+    return buffer;
+}
+
+static void trace_push(TraceName name, char phase, uint64_t time, uint32_t duration) {
+    TraceBuffer* buffer = trace_buffer();
+    if(!buffer) return;
+
+    TraceEvent event = {time, duration, (uint8_t)name, phase, buffer->tid};
+    if(!spsc_ring_push(&buffer->ring, &event)) {
+        atomic_fetch_add_explicit(&buffer->dropped, 1, memory_order_relaxed);
+    }
+}
+
+void trace_complete(TraceName name, uint64_t start, uint64_t end) {
+    if(!atomic_load_explicit(&trace_enabled, memory_order_relaxed)) return;
+    uint64_t duration = end - start;
+    trace_push(name, 'X', start, duration > UINT32_MAX ? UINT32_MAX : (uint32_t)duration);
+}
+
+void trace_begin(TraceName name) {
+    if(trace_recording()) trace_push(name, 'B', trace_clock(), 0);
+}
+
+void trace_end(TraceName name) {
+    if(trace_recording()) trace_push(name, 'E', trace_clock(), 0);
+}
+
+// Shown as the thread's track name; the last call wins
+void trace_thread_name(const char* name) {
+    if(!atomic_load_explicit(&trace_enabled, memory_order_relaxed)) return;
+    TraceBuffer* buffer = trace_buffer();
+    if(buffer) snprintf(buffer->thread_name, sizeof(buffer->thread_name), "%s", name);
+}
+
+static double trace_us(uint64_t time) {
+    return (double)(int64_t)(time - trace_origin) / trace_ticks_per_us;
+}
+
+static void trace_write_event(const TraceEvent* event) {
+    fprintf(trace_file,
+            "%s{\"name\":\"%s\",\"cat\":\"holdem\",\"ph\":\"%c\",\"ts\":%.3f,",
+            trace_written ? ",\n" : "",
+            trace_names[event->name],
+            event->phase,
+            trace_us(event->time));
+    if(event->phase == 'X') {
+        fprintf(trace_file, "\"dur\":%.3f,", event->duration / trace_ticks_per_us);
+    }
+    fprintf(trace_file, "\"pid\":1,\"tid\":%u}", event->tid);
+    trace_written++;
+}
+
+// Moves everything recorded so far from the rings to the spool
+static void trace_drain(void) {
+    static TraceEvent batch[TRACE_SPOOL_BATCH];
+    size_t count = 0;
+
+    for(TraceBuffer* buffer = atomic_load_explicit(&trace_buffers, memory_order_acquire); buffer;
+        buffer = buffer->next) {
+        while(spsc_ring_pop(&buffer->ring, &batch[count])) {
+            if(++count < TRACE_SPOOL_BATCH) continue;
+            if(fwrite(batch, sizeof(TraceEvent), count, trace_spool) != count) trace_spool_failed = true;
+            count = 0;
+        }
+    }
+    if(count && fwrite(batch, sizeof(TraceEvent), count, trace_spool) != count) trace_spool_failed = true;
+}
+
+static void trace_write_spool(void) {
+    static TraceEvent batch[TRACE_SPOOL_BATCH];
+    size_t count;
+
+    rewind(trace_spool);
+    while((count = fread(batch, sizeof(TraceEvent), TRACE_SPOOL_BATCH, trace_spool)) > 0) {
+        for(size_t i = 0; i < count; i++) {
+            trace_write_event(&batch[i]);
+        }
+    }
+}
+
+static void* trace_writer_thread(void* ctx) {
+    (void)ctx;
+    struct timespec pause = {0, TRACE_FLUSH_US * 1000};
+
+    while(!atomic_load_explicit(&trace_stop, memory_order_acquire)) {
+        trace_drain();
+        nanosleep(&pause, NULL);
+    }
+    return NULL;
+}
+
+// Ticks per microsecond, measured against the wall clock for 10 ms
+static double trace_calibrate(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t start_us = platform_time_us();
+    uint64_t start = trace_clock();
+    uint64_t elapsed_us;
+    do {
+        elapsed_us = platform_time_us() - start_us;
+    } while(elapsed_us < 10000);
+    return (double)(trace_clock() - start) / elapsed_us;
+#else
+    return 1000.0;
+#endif
+}
+
+// Starts recording to a new Chrome trace file at `path`. Only one trace
+// can be open at a time.
+bool trace_open(const char* path) {
+    trace_file = fopen(path, "w");
+    if(!trace_file) return false;
+    trace_spool = tmpfile();
+    if(!trace_spool) {
+        fclose(trace_file);
+        trace_file = NULL;
+        return false;
+    }
+    trace_spool_failed = false;
+
+    trace_ticks_per_us = trace_calibrate();
+    trace_origin = trace_clock();
+    trace_written = 0;
+    fprintf(trace_file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+    atomic_store_explicit(&trace_stop, false, memory_order_relaxed);
+    atomic_fetch_add_explicit(&trace_generation, 1, memory_order_relaxed);
+    if(pthread_create(&trace_writer, NULL, trace_writer_thread, NULL) != 0) {
+        fclose(trace_spool);
+        fclose(trace_file);
+        trace_file = NULL;
+        return false;
+    }
+    atomic_store_explicit(&trace_enabled, true, memory_order_release);
+    return true;
+}
+
+// Stops recording, writes out what is left and frees the buffers. Threads
+// that record must be done (joined, or idle) by now. `stats` may be NULL.
+bool trace_close(TraceStats* stats) {
+    if(!trace_file) return false;
+
+    atomic_store_explicit(&trace_enabled, false, memory_order_relaxed);
+    atomic_store_explicit(&trace_stop, true, memory_order_release);
+    pthread_join(trace_writer, NULL);
+    trace_drain();
+    trace_write_spool();
+
+    TraceStats totals = {0};
+    TraceBuffer* buffer = atomic_exchange_explicit(&trace_buffers, NULL, memory_order_acquire);
+    fprintf(trace_file,
+            "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"holdem\"}}",
+            trace_written ? ",\n" : "");
+    while(buffer) {
+        TraceBuffer* next = buffer->next;
+        fprintf(trace_file,
+                ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                buffer->tid,
+                buffer->thread_name);
+        totals.dropped += atomic_load_explicit(&buffer->dropped, memory_order_relaxed);
+        totals.threads++;
+        free(buffer);
+        buffer = next;
+    }
+    atomic_store_explicit(&trace_thread_count, 0, memory_order_relaxed);
+    totals.events = trace_written;
+    fprintf(trace_file, "\n]}\n");
+
+    bool written = !ferror(trace_file) && !trace_spool_failed && !ferror(trace_spool);
+    fclose(trace_spool);
+    if(fclose(trace_file) != 0) written = false;
+    trace_file = NULL;
+    if(stats) *stats = totals;
+    return written;
+}
+
+#endif
\ No newline at end of file
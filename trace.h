@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+
+// Timeline tracing for the host tools, written as Chrome trace JSON (open
+// it in ui.perfetto.dev or chrome://tracing). Build with HOLDEM_TRACE
+// (make TRACE=1) to enable it; otherwise the TRACE_* macros expand to
+// nothing and none of this is linked in. Host only: the device has no
+// threads worth a timeline and no room for the buffers.
+//
+// Every thread that records gets its own lock-free ring (an SpscRing of
+// 16-byte events), so recording is a timestamp and a copy with no locks and
+// no shared cache lines. A writer thread started by trace_open drains the
+// rings into the file. When a ring is full the event is dropped and
+// counted rather than stalling the game.
+
+typedef enum {
+    TRACE_PREFLOP = 0, // Betting rounds, in GamePhase order
+    TRACE_FLOP,
+    TRACE_TURN,
+    TRACE_RIVER,
+    TRACE_DEAL, // engine_new_hand
+    TRACE_AI_DECIDE, // ai_decide
+    TRACE_SHOWDOWN, // engine_showdown
+    TRACE_AI_WORKER_WAIT, // AIWorker thread idle, waiting for a request
+    TRACE_NAME_COUNT
+} TraceName;
+
+typedef struct {
+    uint64_t events;
+    uint64_t dropped;
+    uint8_t threads;
+} TraceStats;
+
+#if defined(HOLDEM_TRACE) && !defined(HOLDEM_HOST)
+#error "HOLDEM_TRACE is only supported by the host build"
+#endif
+
+#ifdef HOLDEM_TRACE
+
+// Raw timestamp: the TSC on x86, nanoseconds elsewhere. trace_open
+// calibrates it against the wall clock.
+static inline uint64_t trace_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+typedef struct {
+    uint8_t name;
+    uint64_t start; // 0: not recording
+} TraceScope;
+
+// Set between trace_open and trace_close; checked before reading the clock
+// so a tracing build costs next to nothing while no trace is open
+extern _Atomic bool trace_enabled;
+// Per thread, see TRACE_SAMPLE
+extern _Thread_local bool trace_paused;
+
+static inline bool trace_recording(void) {
+    return atomic_load_explicit(&trace_enabled, memory_order_relaxed) && !trace_paused;
+}
+
+void trace_complete(TraceName name, uint64_t start, uint64_t end);
+void trace_begin(TraceName name);
+void trace_end(TraceName name);
+
+static inline TraceScope trace_scope_begin(TraceName name) {
+    if(!trace_recording()) return (TraceScope){name, 0};
+    return (TraceScope){name, trace_clock()};
+}
+
+static inline void trace_scope_end(TraceScope* scope) {
+    if(scope->start) trace_complete((TraceName)scope->name, scope->start, trace_clock());
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+// One span for the rest of the enclosing block
+#define TRACE_SCOPE(name)                                                    \
+    TraceScope TRACE_CONCAT(trace_scope_, __LINE__)                          \
+        __attribute__((cleanup(trace_scope_end))) = trace_scope_begin(name)
+
+// Spans that do not follow a block; must nest properly on each thread
+#define TRACE_BEGIN(name) trace_begin(name)
+#define TRACE_END(name) trace_end(name)
+#define TRACE_THREAD_NAME(name) trace_thread_name(name)
+
+// Each event costs two clock reads and a ring write, tens of nanoseconds,
+// which is a lot next to a simulated hand of a microsecond or two. Drivers
+// that play hands that fast record only some of them: call this between
+// hands (no span open) to turn recording on this thread on or off.
+#define TRACE_SAMPLE(on) (trace_paused = !(on))
+
+// Betting round spans for a driver loop: `from` is the phase before an
+// action and `to` the phase after it. From PHASE_SHOWDOWN it opens the
+// first round of a new hand.
+#define TRACE_STREET(from, to)                                          \
+    do {                                                                \
+        if((from) != (to)) {                                            \
+            if((from) != PHASE_SHOWDOWN) {                              \
+                trace_end((TraceName)(TRACE_PREFLOP + (from)));         \
+            }                                                           \
+            if((to) != PHASE_SHOWDOWN) {                                \
+                trace_begin((TraceName)(TRACE_PREFLOP + (to)));         \
+            }                                                           \
+        }                                                               \
+    } while(0)
+
+// Function declarations
+bool trace_open(const char* path);
+void trace_thread_name(const char* name);
+bool trace_close(TraceStats* stats);
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END(name) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#define TRACE_SAMPLE(on) ((void)sizeof(on))
+#define TRACE_STREET(from, to) ((void)sizeof((from) != (to)))
+
+#endif
\ No newline at end of file
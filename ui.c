@@ -3,6 +3,90 @@
 #include <furi.h>
 #include <string.h>
 
+#define UI_GLYPH_HEIGHT 7
+#define UI_CARD_ROW_BYTES ((CARD_WIDTH + 7) / 8)
+
+// 5x7 rank glyphs, 2 to ace; one byte per row, bit 0 = leftmost pixel (XBM order)
+static const uint8_t ui_rank_glyphs[13][UI_GLYPH_HEIGHT] = {
+    {0x0E, 0x11, 0x10, 0x08, 0x04, 0x02, 0x1F}, // 2
+    {0x0F, 0x10, 0x10, 0x0E, 0x10, 0x10, 0x0F}, // 3
+    {0x08, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x08}, // 4
+    {0x1F, 0x01, 0x0F, 0x10, 0x10, 0x11, 0x0E}, // 5
+    {0x0E, 0x01, 0x01, 0x0F, 0x11, 0x11, 0x0E}, // 6
+    {0x1F, 0x10, 0x08, 0x04, 0x02, 0x02, 0x02}, // 7
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, // 8
+    {0x0E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x0E}, // 9
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // T
+    {0x1C, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06}, // J
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16}, // Q
+    {0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11}, // K
+    {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // A
+};
+
+// 5x7 suit glyphs in CardSuit order
+static const uint8_t ui_suit_glyphs[4][UI_GLYPH_HEIGHT] = {
+    {0x00, 0x0A, 0x1F, 0x1F, 0x0E, 0x04, 0x00}, // hearts
+    {0x00, 0x04, 0x0E, 0x1F, 0x0E, 0x04, 0x00}, // diamonds
+    {0x04, 0x0E, 0x04, 0x1F, 0x1F, 0x04, 0x0E}, // clubs
+    {0x04, 0x0E, 0x1F, 0x1F, 0x1F, 0x04, 0x0E}, // spades
+};
+
+// Card faces composed once from the glyphs (frame, rank, suit) so drawing a
+// card is a single canvas_draw_xbm
+static uint8_t ui_card_faces[DECK_SIZE][CARD_HEIGHT * UI_CARD_ROW_BYTES];
+static bool ui_card_faces_ready = false;
+
+// Formatted number label, reformatted only when its value changes
+typedef struct {
+    bool valid;
+    uint32_t value;
+    char text[16];
+} UILabel;
+
+// Only the GUI thread draws, so these caches need no locking
+static UILabel ui_chip_labels[MAX_PLAYERS];
+static UILabel ui_bet_labels[MAX_PLAYERS];
+static UILabel ui_pot_label;
+static UILabel ui_current_bet_label;
+static UILabel ui_hand_label;
+
+static const char* ui_label(UILabel* label, const char* format, uint32_t value) {
+    if(!label->valid || label->value != value) {
+        snprintf(label->text, sizeof(label->text), format, value);
+        label->value = value;
+        label->valid = true;
+    }
+    return label->text;
+}
+
+static void ui_card_faces_init(void) {
+    for(Card card = 0; card < DECK_SIZE; card++) {
+        uint8_t* face = ui_card_faces[card];
+        const uint8_t* rank = ui_rank_glyphs[poker_card_rank(card) - RANK_2];
+        const uint8_t* suit = ui_suit_glyphs[poker_card_suit(card)];
+        
+        for(uint8_t y = 0; y < CARD_HEIGHT; y++) {
+            uint16_t row;
+            if(y == 0 || y == CARD_HEIGHT - 1) {
+                // Top and bottom edges, corners left open for a rounded look
+                row = (uint16_t)(((1u << CARD_WIDTH) - 1) & ~1u & ~(1u << (CARD_WIDTH - 1)));
+            } else {
+                row = (uint16_t)(1u | (1u << (CARD_WIDTH - 1)));
+            }
+            
+            // Rank at x = 2, suit at x = 9, both from y = 3
+            if(y >= 3 && y < 3 + UI_GLYPH_HEIGHT) {
+                row |= (uint16_t)(rank[y - 3] << 2);
+                row |= (uint16_t)(suit[y - 3] << 9);
+            }
+            
+            face[y * UI_CARD_ROW_BYTES] = (uint8_t)row;
+            face[y * UI_CARD_ROW_BYTES + 1] = (uint8_t)(row >> 8);
+        }
+    }
+    ui_card_faces_ready = true;
+}
+
 void ui_get_card_display(Card card, char* buffer, size_t buffer_size) {
     const char* rank_chars = "23456789TJQKA";
     const char* suit_symbols[] = {"♥", "♦", "♣", "♠"};
@@ -10,26 +94,19 @@ void ui_get_card_display(Card card, char* buffer, size_t buffer_size) {
     if(buffer_size >= 4) {
         // Use simple letters for now since Unicode might not be supported
         const char* suit_chars = "HDCS";
-        buffer[0] = rank_chars[card.rank - 2];
-        buffer[1] = suit_chars[card.suit];
+        buffer[0] = rank_chars[poker_card_rank(card) - RANK_2];
+        buffer[1] = suit_chars[poker_card_suit(card)];
         buffer[2] = '\0';
     }
 }
 
 void ui_draw_cards(Canvas* canvas, Card* cards, uint8_t count, uint8_t x, uint8_t y) {
+    if(!ui_card_faces_ready) ui_card_faces_init();
+    
     for(uint8_t i = 0; i < count; i++) {
         uint8_t card_x = x + (i * (CARD_WIDTH + 2));
         
-        // Draw card background
-        canvas_draw_rframe(canvas, card_x, y, CARD_WIDTH, CARD_HEIGHT, 2);
-        canvas_draw_frame(canvas, card_x, y, CARD_WIDTH, CARD_HEIGHT);
-        
-        // Draw card text
-        char card_str[4];
-        ui_get_card_display(cards[i], card_str, sizeof(card_str));
-        
-        canvas_set_font(canvas, FontSecondary);
-        canvas_draw_str(canvas, card_x + 2, y + 8, card_str);
+        canvas_draw_xbm(canvas, card_x, y, CARD_WIDTH, CARD_HEIGHT, ui_card_faces[cards[i]]);
     }
 }
 
@@ -43,9 +120,13 @@ void ui_draw_community_cards(Canvas* canvas, Card* community, uint8_t count) {
     ui_draw_cards(canvas, community, count, start_x, 10);
 }
 
-void ui_draw_player_info(Canvas* canvas, Player* player, uint8_t x, uint8_t y, bool is_current) {
-    char info_str[32];
-    
+// Seat 0 is the human, the others are the AI opponents
+const char* ui_player_name(uint8_t seat) {
+    static const char* names[MAX_PLAYERS] = {"You", "AI1", "AI2", "AI3"};
+    return seat < MAX_PLAYERS ? names[seat] : "";
+}
+
+void ui_draw_player_info(Canvas* canvas, Player* player, uint8_t seat, uint8_t x, uint8_t y, bool is_current) {
     // Highlight current player
     if(is_current) {
         canvas_draw_rframe(canvas, x - 1, y - 1, 30, 12, 1);
@@ -53,16 +134,14 @@ void ui_draw_player_info(Canvas* canvas, Player* player, uint8_t x, uint8_t y, b
     
     // Draw player name
     canvas_set_font(canvas, FontSecondary);
-    canvas_draw_str(canvas, x, y, player->name);
+    canvas_draw_str(canvas, x, y, ui_player_name(seat));
     
     // Draw chips
-    snprintf(info_str, sizeof(info_str), "$%lu", player->chips);
-    canvas_draw_str(canvas, x, y + 8, info_str);
+    canvas_draw_str(canvas, x, y + 8, ui_label(&ui_chip_labels[seat], "$%lu", player->chips));
     
     // Draw current bet if any
     if(player->bet > 0) {
-        snprintf(info_str, sizeof(info_str), "Bet:%lu", player->bet);
-        canvas_draw_str(canvas, x, y + 16, info_str);
+        canvas_draw_str(canvas, x, y + 16, ui_label(&ui_bet_labels[seat], "Bet:%lu", player->bet));
     }
     
     // Draw status
@@ -89,15 +168,12 @@ void ui_draw_player_info(Canvas* canvas, Player* player, uint8_t x, uint8_t y, b
 }
 
 void ui_draw_pot_info(Canvas* canvas, uint32_t pot, uint32_t current_bet) {
-    char pot_str[32];
-    
     canvas_set_font(canvas, FontSecondary);
-    snprintf(pot_str, sizeof(pot_str), "Pot: $%lu", pot);
-    canvas_draw_str(canvas, 2, SCREEN_HEIGHT - 24, pot_str);
+    canvas_draw_str(canvas, 2, SCREEN_HEIGHT - 24, ui_label(&ui_pot_label, "Pot: $%lu", pot));
     
     if(current_bet > 0) {
-        snprintf(pot_str, sizeof(pot_str), "Bet: $%lu", current_bet);
-        canvas_draw_str(canvas, 2, SCREEN_HEIGHT - 16, pot_str);
+        canvas_draw_str(
+            canvas, 2, SCREEN_HEIGHT - 16, ui_label(&ui_current_bet_label, "Bet: $%lu", current_bet));
     }
 }
 
@@ -140,6 +216,45 @@ void ui_draw_notification(Canvas* canvas, const char* message) {
     canvas_draw_str(canvas, x, y, message);
 }
 
+// Microseconds with one decimal, from cycles, without float formatting
+static void ui_format_us(char* buffer, size_t size, uint32_t cycles, uint32_t cycles_per_us) {
+    uint32_t tenths = (uint32_t)((uint64_t)cycles * 10 / cycles_per_us);
+    if(tenths >= 1000) {
+        snprintf(buffer, size, "%lu", (unsigned long)(tenths / 10));
+    } else {
+        snprintf(buffer, size, "%lu.%lu", (unsigned long)(tenths / 10), (unsigned long)(tenths % 10));
+    }
+}
+
+// Debug overlay of the profiling probes: p50, p99 and max per probe in us
+void ui_draw_profile(Canvas* canvas, const ProfileSummary* summaries, uint8_t count, uint32_t cycles_per_us) {
+    char text[12];
+    
+    canvas_clear(canvas);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_set_font(canvas, FontSecondary);
+    canvas_draw_str(canvas, 0, 8, "us");
+    canvas_draw_str_aligned(canvas, 68, 8, AlignRight, AlignBottom, "p50");
+    canvas_draw_str_aligned(canvas, 98, 8, AlignRight, AlignBottom, "p99");
+    canvas_draw_str_aligned(canvas, 127, 8, AlignRight, AlignBottom, "max");
+    canvas_draw_line(canvas, 0, 10, 127, 10);
+    
+    for(uint8_t i = 0; i < count; i++) {
+        uint8_t y = 19 + i * 9;
+        canvas_draw_str(canvas, 0, y, profile_probe_name((ProfileProbe)i));
+        if(summaries[i].count == 0) {
+            canvas_draw_str_aligned(canvas, 127, y, AlignRight, AlignBottom, "-");
+            continue;
+        }
+        ui_format_us(text, sizeof(text), summaries[i].p50, cycles_per_us);
+        canvas_draw_str_aligned(canvas, 68, y, AlignRight, AlignBottom, text);
+        ui_format_us(text, sizeof(text), summaries[i].p99, cycles_per_us);
+        canvas_draw_str_aligned(canvas, 98, y, AlignRight, AlignBottom, text);
+        ui_format_us(text, sizeof(text), summaries[i].max, cycles_per_us);
+        canvas_draw_str_aligned(canvas, 127, y, AlignRight, AlignBottom, text);
+    }
+}
+
 void ui_draw_game_screen(Canvas* canvas, GameState* game) {
     canvas_clear(canvas);
     canvas_set_color(canvas, ColorBlack);
@@ -148,13 +263,13 @@ void ui_draw_game_screen(Canvas* canvas, GameState* game) {
     ui_draw_community_cards(canvas, game->community, game->community_count);
     
     // Draw AI players info (players 1, 2, 3)
-    ui_draw_player_info(canvas, &game->players[1], 2, 25, game->current_player == 1);
-    ui_draw_player_info(canvas, &game->players[2], 50, 25, game->current_player == 2);
-    ui_draw_player_info(canvas, &game->players[3], 98, 25, game->current_player == 3);
+    ui_draw_player_info(canvas, &game->players[1], 1, 2, 25, game->current_player == 1);
+    ui_draw_player_info(canvas, &game->players[2], 2, 50, 25, game->current_player == 2);
+    ui_draw_player_info(canvas, &game->players[3], 3, 98, 25, game->current_player == 3);
     
     // Draw human player (player 0) at bottom
     Player* human = &game->players[0];
-    ui_draw_player_info(canvas, human, 2, SCREEN_HEIGHT - 48, game->current_player == 0);
+    ui_draw_player_info(canvas, human, 0, 2, SCREEN_HEIGHT - 48, game->current_player == 0);
     
     // Draw human player's cards
     if(!human->folded) {
@@ -170,9 +285,7 @@ void ui_draw_game_screen(Canvas* canvas, GameState* game) {
     canvas_draw_str(canvas, SCREEN_WIDTH - 40, 8, phase_names[game->phase]);
     
     // Draw hand number
-    char hand_str[16];
-    snprintf(hand_str, sizeof(hand_str), "Hand #%lu", game->hand_number);
-    canvas_draw_str(canvas, 2, 8, hand_str);
+    canvas_draw_str(canvas, 2, 8, ui_label(&ui_hand_label, "Hand #%lu", game->hand_number));
     
     // Draw blind indicators
     if(game->phase == PHASE_PREFLOP && game->blinds_posted) {
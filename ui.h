@@ -2,6 +2,7 @@
 
 #include <gui/gui.h>
 #include "poker.h"
+#include "profile.h"
 
 // UI constants
 #define SCREEN_WIDTH 128
@@ -29,8 +30,10 @@ typedef enum {
 void ui_draw_game_screen(Canvas* canvas, GameState* game);
 void ui_draw_menu(Canvas* canvas, MenuOption selected);
 void ui_draw_cards(Canvas* canvas, Card* cards, uint8_t count, uint8_t x, uint8_t y);
-void ui_draw_player_info(Canvas* canvas, Player* player, uint8_t x, uint8_t y, bool is_current);
+void ui_draw_player_info(Canvas* canvas, Player* player, uint8_t seat, uint8_t x, uint8_t y, bool is_current);
+const char* ui_player_name(uint8_t seat);
 void ui_draw_community_cards(Canvas* canvas, Card* community, uint8_t count);
 void ui_draw_pot_info(Canvas* canvas, uint32_t pot, uint32_t current_bet);
 void ui_draw_notification(Canvas* canvas, const char* message);
+void ui_draw_profile(Canvas* canvas, const ProfileSummary* summaries, uint8_t count, uint32_t cycles_per_us);
 void ui_get_card_display(Card card, char* buffer, size_t buffer_size);
\ No newline at end of file